@@ -37,7 +37,10 @@ namespace iroha_cli {
             {iroha::protocol::TxStatus::COMMITTED,
              "Transaction was successfully committed."},
             {iroha::protocol::TxStatus::NOT_RECEIVED,
-             "Transaction was not found in the system."}};
+             "Transaction was not found in the system."},
+            {iroha::protocol::TxStatus::OVERLOADED,
+             "Transaction was rejected because the network is overloaded. "
+             "Try to resend it later."}};
 
     InteractiveStatusCli::InteractiveStatusCli(
         const std::string &default_peer_ip, int default_port)
@@ -22,6 +22,7 @@
 #include <cmath>
 #include <rxcpp/rx-observable.hpp>
 
+#include "block.pb.h"
 #include "common/result.hpp"
 #include "common/types.hpp"
 #include "interfaces/iroha_internal/block.hpp"
@@ -38,6 +39,7 @@ namespace iroha {
       using wTransaction =
           std::shared_ptr<shared_model::interface::Transaction>;
       using wBlock = std::shared_ptr<shared_model::interface::Block>;
+      using wBlockTransport = std::shared_ptr<iroha::protocol::Block>;
 
      public:
       virtual ~BlockQuery() = default;
@@ -77,6 +79,17 @@ namespace iroha {
           shared_model::interface::types::HeightType height,
           uint32_t count) = 0;
 
+      /**
+       * Get given number of blocks starting with given height in transport
+       * format, without building models. Used to send blocks to other peers
+       * @param height - starting height
+       * @param count - number of blocks to retrieve
+       * @return observable of protobuf Block
+       */
+      virtual rxcpp::observable<wBlockTransport> getBlockTransports(
+          shared_model::interface::types::HeightType height,
+          uint32_t count) = 0;
+
       /**
        * Get all blocks starting from given height.
        * @param from - starting height
@@ -114,6 +127,15 @@ namespace iroha {
        */
       virtual bool hasTxWithHash(const shared_model::crypto::Hash &hash) = 0;
 
+      /**
+       * Synchronously gets hashes of transactions committed in blocks
+       * starting from given height
+       * @param height - starting height
+       * @return vector of transaction hashes, the newest blocks first
+       */
+      virtual std::vector<shared_model::crypto::Hash> getTxHashesFrom(
+          shared_model::interface::types::HeightType height) = 0;
+
       /**
        * Get the top-most block
        * @return result of Model Block or error message
@@ -0,0 +1,431 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/file_ordering_service_persistent_state.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <boost/crc.hpp>
+#include <boost/filesystem.hpp>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+#include "backend/protobuf/transaction.hpp"
+
+namespace {
+  using RecordType =
+      iroha::ametsuchi::FileOrderingServicePersistentState::RecordType;
+
+  // Record layout: payload size (uint32), type (uint8), payload,
+  // crc32 of type and payload (uint32). Numbers are in host byte order,
+  // since the log is local to the peer.
+  constexpr size_t kSizeLength = sizeof(uint32_t);
+  constexpr size_t kOverhead =
+      kSizeLength + sizeof(uint8_t) + sizeof(uint32_t);
+
+  /// log size after which it may be rewritten
+  constexpr size_t kCompactionThreshold = 16 * 1024 * 1024;
+
+  template <typename T>
+  void putValue(std::string &out, T value) {
+    out.append(reinterpret_cast<const char *>(&value), sizeof(value));
+  }
+
+  template <typename T>
+  bool getValue(const std::string &in, size_t &pos, T &value) {
+    if (in.size() - pos < sizeof(value)) {
+      return false;
+    }
+    std::memcpy(&value, in.data() + pos, sizeof(value));
+    pos += sizeof(value);
+    return true;
+  }
+
+  void putBytes(std::string &out, const std::string &bytes) {
+    putValue(out, static_cast<uint32_t>(bytes.size()));
+    out.append(bytes);
+  }
+
+  bool getBytes(const std::string &in, size_t &pos, std::string &bytes) {
+    uint32_t size;
+    if (not getValue(in, pos, size) or in.size() - pos < size) {
+      return false;
+    }
+    bytes = in.substr(pos, size);
+    pos += size;
+    return true;
+  }
+
+  uint32_t checksum(const char *data, size_t size) {
+    boost::crc_32_type crc;
+    crc.process_bytes(data, size);
+    return crc.checksum();
+  }
+
+  std::string makeRecord(RecordType type, const std::string &payload) {
+    std::string record;
+    record.reserve(payload.size() + kOverhead);
+    putValue(record, static_cast<uint32_t>(payload.size()));
+    putValue(record, static_cast<uint8_t>(type));
+    record.append(payload);
+    putValue(record,
+             checksum(record.data() + kSizeLength,
+                      record.size() - kSizeLength));
+    return record;
+  }
+
+  std::string makeTransactionPayload(const std::string &hash,
+                                     const std::string &transaction) {
+    std::string payload;
+    putBytes(payload, hash);
+    putBytes(payload, transaction);
+    return payload;
+  }
+
+  std::string makeHeightPayload(size_t height) {
+    std::string payload;
+    putValue(payload, static_cast<uint64_t>(height));
+    return payload;
+  }
+
+  std::string toBytes(const shared_model::crypto::Hash &hash) {
+    return std::string(hash.blob().begin(), hash.blob().end());
+  }
+
+  bool writeAll(int fd, const std::string &data) {
+    size_t written = 0;
+    while (written < data.size()) {
+      auto result =
+          ::write(fd, data.data() + written, data.size() - written);
+      if (result < 0) {
+        if (errno == EINTR) {
+          continue;
+        }
+        return false;
+      }
+      written += result;
+    }
+    return true;
+  }
+
+  bool syncDirectory(const std::string &path) {
+    auto directory = boost::filesystem::path(path).parent_path();
+    auto fd = ::open(directory.empty() ? "." : directory.c_str(), O_RDONLY);
+    if (fd < 0) {
+      return false;
+    }
+    auto result = ::fsync(fd);
+    ::close(fd);
+    return result == 0;
+  }
+}  // namespace
+
+namespace iroha {
+  namespace ametsuchi {
+
+    expected::Result<std::shared_ptr<FileOrderingServicePersistentState>,
+                     std::string>
+    FileOrderingServicePersistentState::create(const std::string &path) {
+      auto log = logger::log("FileOrderingServicePersistentState::create()");
+
+      std::string content;
+      {
+        std::ifstream file(path, std::ios::binary);
+        content.assign(std::istreambuf_iterator<char>(file),
+                       std::istreambuf_iterator<char>());
+      }
+
+      auto fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_APPEND, 0644);
+      if (fd < 0) {
+        return expected::makeError("Cannot open ordering service log " + path
+                                   + ": " + std::strerror(errno));
+      }
+      auto state =
+          std::make_shared<FileOrderingServicePersistentState>(path, fd, 0);
+
+      size_t valid = 0;
+      {
+        std::lock_guard<std::mutex> lock(state->mutex_);
+        for (size_t pos = 0; pos < content.size(); valid = pos) {
+          uint32_t size;
+          uint8_t type;
+          uint32_t stored;
+          if (not getValue(content, pos, size)
+              or not getValue(content, pos, type)
+              or content.size() - pos < size) {
+            break;
+          }
+          auto payload = content.substr(pos, size);
+          pos += size;
+          if (not getValue(content, pos, stored)
+              or stored != checksum(content.data() + valid + kSizeLength,
+                                    sizeof(type) + size)
+              or not state->apply(static_cast<RecordType>(type), payload)) {
+            break;
+          }
+        }
+      }
+
+      if (valid < content.size()) {
+        log->warn("Discarding {} bytes of incomplete records in {}",
+                  content.size() - valid,
+                  path);
+        if (::ftruncate(fd, valid) != 0) {
+          return expected::makeError("Cannot truncate ordering service log "
+                                     + path + ": " + std::strerror(errno));
+        }
+      }
+      state->log_size_ = valid;
+      log->info("Restored proposal height {} and {} transactions from {}",
+                state->height_,
+                state->pending_.size(),
+                path);
+      return expected::makeValue(state);
+    }
+
+    FileOrderingServicePersistentState::FileOrderingServicePersistentState(
+        std::string path, int fd, size_t log_size)
+        : path_(std::move(path)),
+          fd_(fd),
+          log_size_(log_size),
+          log_(logger::log("FileOrderingServicePersistentState")) {}
+
+    bool FileOrderingServicePersistentState::saveProposalHeight(
+        size_t height) {
+      return append(RecordType::kHeight, makeHeightPayload(height));
+    }
+
+    boost::optional<size_t>
+    FileOrderingServicePersistentState::loadProposalHeight() const {
+      std::lock_guard<std::mutex> lock(mutex_);
+      return height_;
+    }
+
+    bool FileOrderingServicePersistentState::savePassedProposalHeight(
+        size_t height) {
+      return append(RecordType::kPassedHeight, makeHeightPayload(height));
+    }
+
+    boost::optional<size_t>
+    FileOrderingServicePersistentState::loadPassedProposalHeight() const {
+      std::lock_guard<std::mutex> lock(mutex_);
+      return passed_height_;
+    }
+
+    bool FileOrderingServicePersistentState::saveTransaction(
+        const shared_model::interface::Transaction &transaction) {
+      const auto &proto =
+          static_cast<const shared_model::proto::Transaction &>(transaction)
+              .getTransport();
+      return append(RecordType::kTransaction,
+                    makeTransactionPayload(toBytes(transaction.hash()),
+                                           proto.SerializeAsString()));
+    }
+
+    bool FileOrderingServicePersistentState::removeTransactions(
+        const std::vector<shared_model::crypto::Hash> &hashes) {
+      if (hashes.empty()) {
+        return true;
+      }
+      std::string payload;
+      for (const auto &hash : hashes) {
+        putBytes(payload, toBytes(hash));
+      }
+      return append(RecordType::kRemove, payload);
+    }
+
+    std::vector<std::shared_ptr<shared_model::interface::Transaction>>
+    FileOrderingServicePersistentState::loadTransactions() const {
+      std::lock_guard<std::mutex> lock(mutex_);
+      std::vector<std::shared_ptr<shared_model::interface::Transaction>>
+          transactions;
+      for (const auto &entry : pending_) {
+        iroha::protocol::Transaction proto;
+        if (not proto.ParseFromString(entry.second)) {
+          log_->error("Cannot parse saved transaction");
+          continue;
+        }
+        transactions.push_back(
+            std::make_shared<shared_model::proto::Transaction>(
+                std::move(proto)));
+      }
+      return transactions;
+    }
+
+    bool FileOrderingServicePersistentState::resetState() {
+      std::lock_guard<std::mutex> lock(mutex_);
+      std::lock_guard<std::mutex> sync_lock(sync_mutex_);
+      pending_.clear();
+      pending_index_.clear();
+      live_size_ = 0;
+      height_ = 2;  // expected height (1 is genesis)
+      passed_height_ = 0;
+      auto record = makeRecord(RecordType::kHeight, makeHeightPayload(height_));
+      if (::ftruncate(fd_, 0) != 0 or not writeAll(fd_, record)
+          or ::fsync(fd_) != 0) {
+        log_->error("Cannot reset {}: {}", path_, std::strerror(errno));
+        return false;
+      }
+      log_size_ = record.size();
+      synced_ = written_ += record.size();
+      return true;
+    }
+
+    FileOrderingServicePersistentState::~FileOrderingServicePersistentState() {
+      ::close(fd_);
+    }
+
+    bool FileOrderingServicePersistentState::apply(
+        RecordType type, const std::string &payload) {
+      size_t pos = 0;
+      switch (type) {
+        case RecordType::kHeight: {
+          uint64_t height;
+          if (not getValue(payload, pos, height)) {
+            return false;
+          }
+          height_ = height;
+          return true;
+        }
+        case RecordType::kPassedHeight: {
+          uint64_t height;
+          if (not getValue(payload, pos, height)) {
+            return false;
+          }
+          passed_height_ = height;
+          return true;
+        }
+        case RecordType::kTransaction: {
+          std::string hash, transaction;
+          if (not getBytes(payload, pos, hash)
+              or not getBytes(payload, pos, transaction)) {
+            return false;
+          }
+          if (pending_index_.count(hash) == 0) {
+            live_size_ += payload.size() + kOverhead;
+            pending_index_.emplace(
+                hash,
+                pending_.emplace(pending_.end(), hash, std::move(transaction)));
+          }
+          return true;
+        }
+        case RecordType::kRemove: {
+          std::vector<std::string> hashes;
+          for (std::string hash; pos < payload.size();) {
+            if (not getBytes(payload, pos, hash)) {
+              return false;
+            }
+            hashes.push_back(std::move(hash));
+          }
+          for (const auto &hash : hashes) {
+            auto it = pending_index_.find(hash);
+            if (it != pending_index_.end()) {
+              live_size_ -= 2 * kSizeLength + it->second->first.size()
+                  + it->second->second.size() + kOverhead;
+              pending_.erase(it->second);
+              pending_index_.erase(it);
+            }
+          }
+          return true;
+        }
+        default:
+          return false;
+      }
+    }
+
+    bool FileOrderingServicePersistentState::append(
+        RecordType type, const std::string &payload) {
+      uint64_t position;
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto record = makeRecord(type, payload);
+        if (not writeAll(fd_, record)) {
+          log_->error("Cannot write to {}: {}", path_, std::strerror(errno));
+          return false;
+        }
+        apply(type, payload);
+        log_size_ += record.size();
+        position = written_ += record.size();
+        if (not compactIfNeeded()) {
+          return false;
+        }
+      }
+      return sync(position);
+    }
+
+    bool FileOrderingServicePersistentState::sync(uint64_t position) {
+      std::lock_guard<std::mutex> lock(sync_mutex_);
+      if (synced_ >= position) {
+        // synced by another writer
+        return true;
+      }
+      uint64_t target = written_;
+      if (::fsync(fd_) != 0) {
+        log_->error("Cannot sync {}: {}", path_, std::strerror(errno));
+        return false;
+      }
+      synced_ = target;
+      return true;
+    }
+
+    bool FileOrderingServicePersistentState::compactIfNeeded() {
+      if (log_size_ < kCompactionThreshold or log_size_ < 2 * live_size_) {
+        return true;
+      }
+      auto previous_size = log_size_;
+      auto tmp_path = path_ + ".tmp";
+      size_t snapshot_size;
+      auto fd = writeSnapshot(tmp_path, snapshot_size);
+      if (fd < 0) {
+        return false;
+      }
+      if (::rename(tmp_path.c_str(), path_.c_str()) != 0) {
+        log_->error("Cannot replace {}: {}", path_, std::strerror(errno));
+        ::close(fd);
+        return false;
+      }
+      if (not syncDirectory(path_)) {
+        log_->warn("Cannot sync directory of {}", path_);
+      }
+
+      std::lock_guard<std::mutex> sync_lock(sync_mutex_);
+      ::close(fd_);
+      fd_ = fd;
+      log_size_ = snapshot_size;
+      // snapshot contains everything written so far and is synced
+      synced_ = written_.load();
+      log_->info("Compacted log from {} to {} bytes", previous_size, log_size_);
+      return true;
+    }
+
+    int FileOrderingServicePersistentState::writeSnapshot(
+        const std::string &path, size_t &size) {
+      auto snapshot =
+          makeRecord(RecordType::kHeight, makeHeightPayload(height_))
+          + makeRecord(RecordType::kPassedHeight,
+                       makeHeightPayload(passed_height_));
+      for (const auto &entry : pending_) {
+        snapshot += makeRecord(
+            RecordType::kTransaction,
+            makeTransactionPayload(entry.first, entry.second));
+      }
+
+      auto fd =
+          ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_APPEND, 0644);
+      if (fd < 0 or not writeAll(fd, snapshot) or ::fsync(fd) != 0) {
+        log_->error("Cannot write snapshot {}: {}", path, std::strerror(errno));
+        if (fd >= 0) {
+          ::close(fd);
+        }
+        return -1;
+      }
+      size = snapshot.size();
+      return fd;
+    }
+
+  }  // namespace ametsuchi
+}  // namespace iroha
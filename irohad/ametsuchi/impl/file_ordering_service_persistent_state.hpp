@@ -0,0 +1,155 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_FILE_ORDERING_SERVICE_PERSISTENT_STATE_HPP
+#define IROHA_FILE_ORDERING_SERVICE_PERSISTENT_STATE_HPP
+
+#include <atomic>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "ametsuchi/ordering_service_persistent_state.hpp"
+#include "common/result.hpp"
+#include "logger/logger.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Class implements OrderingServicePersistentState as a local append-only
+     * log of proposal heights, accepted and removed transactions.
+     * Concurrent writers share fsync calls: a writer waits for an fsync
+     * which covers its record, and an fsync covers all records written
+     * before it started.
+     * The log is rewritten to a snapshot of the current state when most of
+     * it is garbage.
+     */
+    class FileOrderingServicePersistentState
+        : public OrderingServicePersistentState {
+     public:
+      /**
+       * Open the log and restore the state from it. Incomplete or corrupted
+       * records at the end of the log are discarded.
+       * @param path - path to log file, created if it does not exist
+       * @return new instance of FileOrderingServicePersistentState
+       */
+      static expected::Result<
+          std::shared_ptr<FileOrderingServicePersistentState>,
+          std::string>
+      create(const std::string &path);
+
+      bool saveProposalHeight(size_t height) override;
+
+      boost::optional<size_t> loadProposalHeight() const override;
+
+      bool savePassedProposalHeight(size_t height) override;
+
+      boost::optional<size_t> loadPassedProposalHeight() const override;
+
+      bool saveTransaction(
+          const shared_model::interface::Transaction &transaction) override;
+
+      bool removeTransactions(
+          const std::vector<shared_model::crypto::Hash> &hashes) override;
+
+      std::vector<std::shared_ptr<shared_model::interface::Transaction>>
+      loadTransactions() const override;
+
+      bool resetState() override;
+
+      ~FileOrderingServicePersistentState() override;
+
+      /// type of log record
+      enum class RecordType : uint8_t {
+        kHeight = 1,
+        kTransaction = 2,
+        kRemove = 3,
+        kPassedHeight = 4
+      };
+
+      /**
+       * Constructor
+       * @param path - path to log file
+       * @param fd - descriptor of log file opened for appending
+       * @param log_size - size of log file
+       */
+      FileOrderingServicePersistentState(std::string path,
+                                         int fd,
+                                         size_t log_size);
+
+     private:
+      /**
+       * Apply record to in-memory state, mutex_ should be locked
+       * @return false if record is malformed
+       */
+      bool apply(RecordType type, const std::string &payload);
+
+      /**
+       * Apply record, append it to the log and wait until it is synced
+       * @return true if record is durable
+       */
+      bool append(RecordType type, const std::string &payload);
+
+      /**
+       * Wait until the log is synced up to given position
+       * @param position - number of bytes written since opening
+       * @return true if synced
+       */
+      bool sync(uint64_t position);
+
+      /**
+       * Rewrite the log to a snapshot of current state if most of it is
+       * garbage, mutex_ should be locked
+       * @return false if rewriting failed
+       */
+      bool compactIfNeeded();
+
+      /**
+       * Write snapshot of current state to file
+       * @param path - path to file
+       * @param size - size of written snapshot
+       * @return descriptor of synced file opened for appending, or -1
+       */
+      int writeSnapshot(const std::string &path, size_t &size);
+
+      const std::string path_;
+
+      /// descriptor of log file, changed only with both mutexes locked
+      int fd_;
+
+      /// size of log file
+      size_t log_size_;
+
+      /// size of records describing current state
+      size_t live_size_{0};
+
+      size_t height_{2};
+
+      /// height of the last proposal passed by ordering gate
+      size_t passed_height_{0};
+
+      using Pending = std::list<std::pair<std::string, std::string>>;
+      /// hashes and serialized transactions in order of acceptance
+      Pending pending_;
+      std::unordered_map<std::string, Pending::iterator> pending_index_;
+
+      /// guards state and writes
+      mutable std::mutex mutex_;
+
+      /// number of bytes written since opening
+      std::atomic<uint64_t> written_{0};
+      /// number of bytes synced since opening
+      std::atomic<uint64_t> synced_{0};
+      /// guards fsync
+      std::mutex sync_mutex_;
+
+      logger::Logger log_;
+    };
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_FILE_ORDERING_SERVICE_PERSISTENT_STATE_HPP
@@ -45,27 +45,40 @@ namespace iroha {
 
     rxcpp::observable<BlockQuery::wBlock> PostgresBlockQuery::getBlocks(
         shared_model::interface::types::HeightType height, uint32_t count) {
+      return getBlockTransports(height, count).map([](const auto &block) {
+        // transport is owned by the observable only, so it is not copied
+        return wBlock(
+            std::make_shared<shared_model::proto::Block>(std::move(*block)));
+      });
+    }
+
+    rxcpp::observable<BlockQuery::wBlockTransport>
+    PostgresBlockQuery::getBlockTransports(
+        shared_model::interface::types::HeightType height, uint32_t count) {
       shared_model::interface::types::HeightType last_id =
           block_store_.last_id();
       auto to = std::min(last_id, height + count - 1);
       if (height > to or count == 0) {
-        return rxcpp::observable<>::empty<wBlock>();
+        return rxcpp::observable<>::empty<wBlockTransport>();
       }
       return rxcpp::observable<>::range(height, to)
           .flat_map([this](const auto &i) {
             auto block = block_store_.get(i) | [](const auto &bytes) {
-              return shared_model::converters::protobuf::jsonToModel<
-                  shared_model::proto::Block>(bytesToString(bytes));
+              return shared_model::converters::protobuf::jsonToProto<
+                  iroha::protocol::Block>(bytesToString(bytes));
             };
-            if (not block) {
+            wBlockTransport transport;
+            if (block) {
+              transport =
+                  std::make_shared<iroha::protocol::Block>(std::move(*block));
+            } else {
               log_->error("error while converting from JSON");
             }
 
-            return rxcpp::observable<>::create<PostgresBlockQuery::wBlock>(
-                [block{std::move(block)}](const auto &s) {
-                  if (block) {
-                    s.on_next(std::make_shared<shared_model::proto::Block>(
-                        block.value()));
+            return rxcpp::observable<>::create<wBlockTransport>(
+                [transport](const auto &s) {
+                  if (transport) {
+                    s.on_next(transport);
                   }
                   s.on_completed();
                 });
@@ -238,6 +251,22 @@ namespace iroha {
       return getBlockId(hash) != boost::none;
     }
 
+    std::vector<shared_model::crypto::Hash> PostgresBlockQuery::getTxHashesFrom(
+        shared_model::interface::types::HeightType height) {
+      return execute_("SELECT hash FROM height_by_hash WHERE "
+                      "height::bigint >= "
+                      + transaction_.quote(height)
+                      + " ORDER BY height::bigint DESC;")
+                 | [&](const auto &result)
+                 -> std::vector<shared_model::crypto::Hash> {
+        return transform<shared_model::crypto::Hash>(
+            result, [&](const auto &row) {
+              return shared_model::crypto::Hash(
+                  pqxx::binarystring(row.at("hash")).str());
+            });
+      };
+    }
+
     uint32_t PostgresBlockQuery::getTopBlockHeight() {
       return block_store_.last_id();
     }
@@ -61,6 +61,10 @@ namespace iroha {
           shared_model::interface::types::HeightType height,
           uint32_t count) override;
 
+      rxcpp::observable<wBlockTransport> getBlockTransports(
+          shared_model::interface::types::HeightType height,
+          uint32_t count) override;
+
       rxcpp::observable<wBlock> getBlocksFrom(
           shared_model::interface::types::HeightType height) override;
 
@@ -70,6 +74,9 @@ namespace iroha {
 
       bool hasTxWithHash(const shared_model::crypto::Hash &hash) override;
 
+      std::vector<shared_model::crypto::Hash> getTxHashesFrom(
+          shared_model::interface::types::HeightType height) override;
+
       expected::Result<wBlock, std::string> getTopBlock() override;
 
      private:
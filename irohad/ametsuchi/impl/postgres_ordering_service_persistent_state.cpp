@@ -20,6 +20,15 @@
 #include <boost/optional.hpp>
 #include "common/types.hpp"
 
+namespace {
+  /// table of ordering gate is created on start, so an existing ledger
+  /// which is not reset gets it as well
+  const std::string kCreateGateTable =
+      "CREATE TABLE IF NOT EXISTS ordering_gate_state (\n"
+      "    passed_proposal_height bigint\n"
+      ");";
+}  // namespace
+
 namespace iroha {
   namespace ametsuchi {
 
@@ -41,6 +50,13 @@ namespace iroha {
       // create transaction
       auto postgres_transaction = std::make_unique<pqxx::nontransaction>(
           *postgres_connection, "Storage");
+      try {
+        postgres_transaction->exec(kCreateGateTable);
+      } catch (const std::exception &e) {
+        return expected::makeError(
+            (boost::format("Cannot create ordering gate state: %s") % e.what())
+                .str());
+      }
       expected::Result<std::shared_ptr<PostgresOrderingServicePersistentState>,
                        std::string>
           storage;
@@ -60,12 +76,14 @@ namespace iroha {
           execute_{ametsuchi::makeExecuteResult(*postgres_transaction_)} {}
 
     bool PostgresOrderingServicePersistentState::initStorage() {
+      std::lock_guard<std::mutex> lock(mutex_);
       return execute_(
                  "CREATE TABLE IF NOT EXISTS ordering_service_state (\n"
                  "    proposal_height bigserial\n"
                  ");\n"
                  "INSERT INTO ordering_service_state\n"
-                 "VALUES (2); -- expected height (1 is genesis)")
+                 "VALUES (2); -- expected height (1 is genesis)\n"
+                 + kCreateGateTable)
           .match([](expected::Value<pqxx::result> v) -> bool { return true; },
                  [&](expected::Error<std::string> e) -> bool {
                    log_->error(e.error);
@@ -74,8 +92,11 @@ namespace iroha {
     }
 
     bool PostgresOrderingServicePersistentState::dropStorgage() {
+      std::lock_guard<std::mutex> lock(mutex_);
       log_->info("Drop storage");
-      return execute_("DROP TABLE IF EXISTS ordering_service_state;")
+      return execute_(
+                 "DROP TABLE IF EXISTS ordering_service_state;\n"
+                 "DROP TABLE IF EXISTS ordering_gate_state;")
           .match([](expected::Value<pqxx::result> v) -> bool { return true; },
                  [&](expected::Error<std::string> e) -> bool {
                    log_->error(e.error);
@@ -85,6 +106,7 @@ namespace iroha {
 
     bool PostgresOrderingServicePersistentState::saveProposalHeight(
         size_t height) {
+      std::lock_guard<std::mutex> lock(mutex_);
       log_->info("Save proposal_height in ordering_service_state "
                  + std::to_string(height));
       return execute_(
@@ -101,6 +123,7 @@ namespace iroha {
 
     boost::optional<size_t>
     PostgresOrderingServicePersistentState::loadProposalHeight() const {
+      std::lock_guard<std::mutex> lock(mutex_);
       boost::optional<size_t> height;
       execute_("SELECT * FROM ordering_service_state;")
           .match(
@@ -121,6 +144,53 @@ namespace iroha {
       return height;
     }
 
+    bool PostgresOrderingServicePersistentState::savePassedProposalHeight(
+        size_t height) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      return execute_(
+                 "DELETE FROM ordering_gate_state;\n"
+                 "INSERT INTO ordering_gate_state "
+                 "VALUES ("
+                 + postgres_transaction_->quote(height) + ");")
+          .match([](expected::Value<pqxx::result> v) -> bool { return true; },
+                 [&](expected::Error<std::string> e) -> bool {
+                   log_->error(e.error);
+                   return false;
+                 });
+    }
+
+    boost::optional<size_t>
+    PostgresOrderingServicePersistentState::loadPassedProposalHeight() const {
+      std::lock_guard<std::mutex> lock(mutex_);
+      boost::optional<size_t> height;
+      execute_("SELECT * FROM ordering_gate_state;")
+          .match(
+              [&](expected::Value<pqxx::result> result) {
+                height = result.value.empty()
+                    ? 0
+                    : result.value.at(0)
+                          .at("passed_proposal_height")
+                          .as<size_t>();
+              },
+              [&](expected::Error<std::string> e) { log_->error(e.error); });
+      return height;
+    }
+
+    bool PostgresOrderingServicePersistentState::saveTransaction(
+        const shared_model::interface::Transaction &transaction) {
+      return true;
+    }
+
+    bool PostgresOrderingServicePersistentState::removeTransactions(
+        const std::vector<shared_model::crypto::Hash> &hashes) {
+      return true;
+    }
+
+    std::vector<std::shared_ptr<shared_model::interface::Transaction>>
+    PostgresOrderingServicePersistentState::loadTransactions() const {
+      return {};
+    }
+
     bool PostgresOrderingServicePersistentState::resetState() {
       return dropStorgage() & initStorage();
     }
@@ -18,6 +18,7 @@
 #ifndef IROHA_POSTGRES_ORDERING_SERVICE_PERSISTENT_STATE_HPP
 #define IROHA_POSTGRES_ORDERING_SERVICE_PERSISTENT_STATE_HPP
 
+#include <mutex>
 #include <pqxx/pqxx>
 #include "ametsuchi/impl/postgres_wsv_common.hpp"
 #include "ametsuchi/ordering_service_persistent_state.hpp"
@@ -30,6 +31,9 @@ namespace iroha {
     /**
      * Class implements OrderingServicePersistentState for persistent storage of
      * Ordering Service with PostgreSQL.
+     * Only proposal height is stored, queued transactions are not kept.
+     * Queries are serialized, since the instance is shared by ordering
+     * service and ordering gate running on different threads.
      */
     class PostgresOrderingServicePersistentState
         : public OrderingServicePersistentState {
@@ -75,6 +79,34 @@ namespace iroha {
        */
       virtual boost::optional<size_t> loadProposalHeight() const;
 
+      /**
+       * Save height of the last proposal passed by ordering gate
+       */
+      virtual bool savePassedProposalHeight(size_t height);
+
+      /**
+       * Load height of the last proposal passed by ordering gate
+       */
+      virtual boost::optional<size_t> loadPassedProposalHeight() const;
+
+      /**
+       * Transactions are not kept, always succeeds
+       */
+      bool saveTransaction(
+          const shared_model::interface::Transaction &transaction) override;
+
+      /**
+       * Transactions are not kept, always succeeds
+       */
+      bool removeTransactions(
+          const std::vector<shared_model::crypto::Hash> &hashes) override;
+
+      /**
+       * Transactions are not kept, always empty
+       */
+      std::vector<std::shared_ptr<shared_model::interface::Transaction>>
+      loadTransactions() const override;
+
       /**
        * Reset storage state to default
        */
@@ -95,6 +127,11 @@ namespace iroha {
 
       using ExecuteType = decltype(makeExecuteResult(*postgres_transaction_));
       ExecuteType execute_;
+
+      /**
+       * Guards the connection, which is not thread-safe
+       */
+      mutable std::mutex mutex_;
     };
   }  // namespace ametsuchi
 }  // namespace iroha
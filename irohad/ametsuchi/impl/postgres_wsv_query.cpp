@@ -153,6 +153,69 @@ namespace iroha {
             };
     }
 
+    boost::optional<
+        std::vector<std::shared_ptr<shared_model::interface::Account>>>
+    PostgresWsvQuery::getAccounts(
+        const std::vector<AccountIdType> &account_ids) {
+      if (account_ids.empty()) {
+        return std::vector<std::shared_ptr<shared_model::interface::Account>>{};
+      }
+      return execute_("SELECT * FROM account WHERE account_id IN ("
+                      + quoteAccountIds(account_ids) + ");")
+                 | [&](const auto &result)
+                 -> boost::optional<std::vector<
+                     std::shared_ptr<shared_model::interface::Account>>> {
+        auto results = transform<shared_model::builder::BuilderResult<
+            shared_model::interface::Account>>(result, makeAccount);
+        std::vector<std::shared_ptr<shared_model::interface::Account>>
+            accounts;
+        for (auto &r : results) {
+          r.match(
+              [&](expected::Value<
+                  std::shared_ptr<shared_model::interface::Account>> &v) {
+                accounts.push_back(v.value);
+              },
+              [&](expected::Error<std::shared_ptr<std::string>> &e) {
+                log_->info(*e.error);
+              });
+        }
+        return accounts;
+      };
+    }
+
+    boost::optional<std::vector<std::pair<AccountIdType, PubkeyType>>>
+    PostgresWsvQuery::getAccountsSignatories(
+        const std::vector<AccountIdType> &account_ids) {
+      if (account_ids.empty()) {
+        return std::vector<std::pair<AccountIdType, PubkeyType>>{};
+      }
+      return execute_(
+                 "SELECT account_id, public_key FROM account_has_signatory "
+                 "WHERE account_id IN ("
+                 + quoteAccountIds(account_ids) + ");")
+          | [&](const auto &result) {
+              return transform<std::pair<AccountIdType, PubkeyType>>(
+                  result, [&](const auto &row) {
+                    pqxx::binarystring public_key_str(row.at(kPublicKey));
+                    return std::make_pair(
+                        AccountIdType(row.at(kAccountId).c_str()),
+                        PubkeyType(public_key_str.str()));
+                  });
+            };
+    }
+
+    std::string PostgresWsvQuery::quoteAccountIds(
+        const std::vector<AccountIdType> &account_ids) {
+      std::string result;
+      for (const auto &account_id : account_ids) {
+        if (not result.empty()) {
+          result += ", ";
+        }
+        result += transaction_.quote(account_id);
+      }
+      return result;
+    }
+
     boost::optional<std::shared_ptr<shared_model::interface::Asset>>
     PostgresWsvQuery::getAsset(const AssetIdType &asset_id) {
       pqxx::result result;
@@ -48,6 +48,17 @@ namespace iroha {
       boost::optional<std::vector<shared_model::interface::types::PubkeyType>>
       getSignatories(const shared_model::interface::types::AccountIdType
                          &account_id) override;
+      boost::optional<
+          std::vector<std::shared_ptr<shared_model::interface::Account>>>
+      getAccounts(
+          const std::vector<shared_model::interface::types::AccountIdType>
+              &account_ids) override;
+      boost::optional<
+          std::vector<std::pair<shared_model::interface::types::AccountIdType,
+                                shared_model::interface::types::PubkeyType>>>
+      getAccountsSignatories(
+          const std::vector<shared_model::interface::types::AccountIdType>
+              &account_ids) override;
       boost::optional<std::shared_ptr<shared_model::interface::Asset>> getAsset(
           const shared_model::interface::types::AssetIdType &asset_id) override;
       boost::optional<
@@ -73,6 +84,13 @@ namespace iroha {
           shared_model::interface::permissions::Grantable permission) override;
 
      private:
+      /**
+       * @return quoted account ids separated by comma
+       */
+      std::string quoteAccountIds(
+          const std::vector<shared_model::interface::types::AccountIdType>
+              &account_ids);
+
       std::unique_ptr<pqxx::lazyconnection> connection_ptr_;
       std::unique_ptr<pqxx::nontransaction> transaction_ptr_;
 
@@ -32,6 +32,9 @@ namespace iroha {
     const char *kCommandExecutorError = "Cannot create CommandExecutorFactory";
     const char *kPsqlBroken = "Connection to PostgreSQL broken: %s";
     const char *kTmpWsv = "TemporaryWsv";
+    /// key of advisory lock, which mutable storage holds exclusively and
+    /// temporary wsv on top of a block holds shared
+    const char *kBlockCommitLock = "5132761";
 
     ConnectionContext::ConnectionContext(
         std::unique_ptr<KeyValueStorage> block_store)
@@ -63,6 +66,55 @@ namespace iroha {
                                              std::move(wsv_transaction)));
     }
 
+    expected::Result<std::unique_ptr<TemporaryWsv>, std::string>
+    StorageImpl::createTemporaryWsv(
+        const shared_model::interface::Block &block) {
+      auto postgres_connection = std::make_unique<pqxx::lazyconnection>(
+          postgres_options_.optionsString());
+      try {
+        postgres_connection->activate();
+      } catch (const pqxx::broken_connection &e) {
+        return expected::makeError(
+            (boost::format(kPsqlBroken) % e.what()).str());
+      }
+      auto wsv_transaction =
+          std::make_unique<pqxx::nontransaction>(*postgres_connection, kTmpWsv);
+      auto &transaction = *wsv_transaction;
+      // the lock is held by the session until the connection is closed, so
+      // the block is either committed before the snapshot or after the view
+      transaction.exec("SELECT pg_advisory_lock_shared("
+                       + std::string(kBlockCommitLock) + ");");
+      auto wsv = std::make_unique<TemporaryWsvImpl>(
+          std::move(postgres_connection), std::move(wsv_transaction), true);
+
+      if (block.transactions().empty()) {
+        return expected::makeValue<std::unique_ptr<TemporaryWsv>>(
+            std::move(wsv));
+      }
+      // height_by_hash indexes hashes of transactions, and the first query
+      // takes the snapshot
+      const auto &hash = block.transactions().begin()->hash().blob();
+      auto committed = not transaction
+                               .exec("SELECT height FROM height_by_hash "
+                                     "WHERE hash = "
+                                     + transaction.quote(pqxx::binarystring(
+                                           hash.data(), hash.size()))
+                                     + ";")
+                               .empty();
+      if (not committed) {
+        for (const auto &tx : block.transactions()) {
+          // transactions of the block passed stateful validation already
+          if (not wsv->apply(tx, [](const auto &, auto &) { return true; })) {
+            return expected::makeError("Failed to apply transaction "
+                                       + tx.hash().hex() + " of block "
+                                       + std::to_string(block.height()));
+          }
+        }
+      }
+      return expected::makeValue<std::unique_ptr<TemporaryWsv>>(
+          std::move(wsv));
+    }
+
     expected::Result<std::unique_ptr<MutableStorage>, std::string>
     StorageImpl::createMutableStorage() {
       auto postgres_connection = std::make_unique<pqxx::lazyconnection>(
@@ -76,19 +128,26 @@ namespace iroha {
       auto wsv_transaction =
           std::make_unique<pqxx::nontransaction>(*postgres_connection, kTmpWsv);
 
+      auto &transaction = *wsv_transaction;
+
       auto block_result = getBlockQuery()->getTopBlock();
+      auto storage = std::make_unique<MutableStorageImpl>(
+          block_result.match(
+              [](expected::Value<
+                  std::shared_ptr<shared_model::interface::Block>> &block) {
+                return block.value->hash();
+              },
+              [](expected::Error<std::string> &) {
+                return shared_model::interface::types::HashType("");
+              }),
+          std::move(postgres_connection),
+          std::move(wsv_transaction));
+      // wait for temporary wsvs on top of blocks, which may apply the same
+      // block, the lock is released by commit or rollback
+      transaction.exec("SELECT pg_advisory_xact_lock("
+                       + std::string(kBlockCommitLock) + ");");
       return expected::makeValue<std::unique_ptr<MutableStorage>>(
-          std::make_unique<MutableStorageImpl>(
-              block_result.match(
-                  [](expected::Value<
-                      std::shared_ptr<shared_model::interface::Block>> &block) {
-                    return block.value->hash();
-                  },
-                  [](expected::Error<std::string> &) {
-                    return shared_model::interface::types::HashType("");
-                  }),
-              std::move(postgres_connection),
-              std::move(wsv_transaction)));
+          std::move(storage));
     }
 
     bool StorageImpl::insertBlock(const shared_model::interface::Block &block) {
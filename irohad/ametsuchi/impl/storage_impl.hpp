@@ -55,6 +55,9 @@ namespace iroha {
       expected::Result<std::unique_ptr<TemporaryWsv>, std::string>
       createTemporaryWsv() override;
 
+      expected::Result<std::unique_ptr<TemporaryWsv>, std::string>
+      createTemporaryWsv(const shared_model::interface::Block &block) override;
+
       expected::Result<std::unique_ptr<MutableStorage>, std::string>
       createMutableStorage() override;
 
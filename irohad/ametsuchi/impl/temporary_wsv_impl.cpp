@@ -25,9 +25,11 @@ namespace iroha {
   namespace ametsuchi {
     TemporaryWsvImpl::TemporaryWsvImpl(
         std::unique_ptr<pqxx::lazyconnection> connection,
-        std::unique_ptr<pqxx::nontransaction> transaction)
+        std::unique_ptr<pqxx::nontransaction> transaction,
+        bool repeatable_read)
         : connection_(std::move(connection)),
           transaction_(std::move(transaction)),
+          repeatable_read_(repeatable_read),
           wsv_(std::make_unique<PostgresWsvQuery>(*transaction_)),
           executor_(std::make_unique<PostgresWsvCommand>(*transaction_)),
           log_(logger::log("TemporaryWSV")) {
@@ -35,7 +37,9 @@ namespace iroha {
       auto command = std::make_shared<PostgresWsvCommand>(*transaction_);
       command_executor_ = std::make_shared<CommandExecutor>(query, command);
       command_validator_ = std::make_shared<CommandValidator>(query);
-      transaction_->exec("BEGIN;");
+      transaction_->exec(repeatable_read_
+                             ? "BEGIN ISOLATION LEVEL REPEATABLE READ;"
+                             : "BEGIN;");
     }
 
     bool TemporaryWsvImpl::apply(
@@ -45,8 +49,7 @@ namespace iroha {
       const auto &tx_creator = tx.creatorAccountId();
       command_executor_->setCreatorAccountId(tx_creator);
       command_validator_->setCreatorAccountId(tx_creator);
-      auto execute_command = [this, &tx_creator](auto &command) {
-        auto account = wsv_->getAccount(tx_creator).value();
+      auto execute_command = [this](auto &command) {
         if (not boost::apply_visitor(*command_validator_, command.get())) {
           return false;
         }
@@ -65,12 +68,38 @@ namespace iroha {
                   tx.commands().begin(), tx.commands().end(), execute_command);
       if (result) {
         transaction_->exec("RELEASE SAVEPOINT savepoint_;");
+        applied_.push_back(&tx);
       } else {
         transaction_->exec("ROLLBACK TO SAVEPOINT savepoint_;");
       }
       return result;
     }
 
+    expected::Result<std::unique_ptr<TemporaryWsv>, std::string>
+    TemporaryWsvImpl::fork() const {
+      auto connection =
+          std::make_unique<pqxx::lazyconnection>(connection_->options());
+      try {
+        connection->activate();
+      } catch (const pqxx::broken_connection &e) {
+        return expected::makeError(
+            std::string("Connection to PostgreSQL broken: ") + e.what());
+      }
+      auto transaction =
+          std::make_unique<pqxx::nontransaction>(*connection, "TemporaryWsv");
+      auto wsv = std::make_unique<TemporaryWsvImpl>(
+          std::move(connection), std::move(transaction), repeatable_read_);
+      for (const auto &tx : applied_) {
+        // transactions passed validation already
+        if (not wsv->apply(*tx, [](const auto &, auto &) { return true; })) {
+          return expected::makeError("Failed to apply transaction "
+                                     + tx->hash().hex());
+        }
+      }
+      return expected::makeValue<std::unique_ptr<TemporaryWsv>>(
+          std::move(wsv));
+    }
+
     TemporaryWsvImpl::~TemporaryWsvImpl() {
       transaction_->exec("ROLLBACK;");
     }
@@ -18,6 +18,8 @@
 #ifndef IROHA_TEMPORARY_WSV_IMPL_HPP
 #define IROHA_TEMPORARY_WSV_IMPL_HPP
 
+#include <vector>
+
 #include <pqxx/connection>
 #include <pqxx/nontransaction>
 
@@ -30,23 +32,40 @@ namespace iroha {
   namespace ametsuchi {
     class TemporaryWsvImpl : public TemporaryWsv {
      public:
+      /**
+       * @param connection - connection used by the wsv only
+       * @param transaction - transaction on the connection
+       * @param repeatable_read - whether all queries read the snapshot taken
+       * by the first one, otherwise each query reads committed state
+       */
       TemporaryWsvImpl(std::unique_ptr<pqxx::lazyconnection> connection,
-                       std::unique_ptr<pqxx::nontransaction> transaction);
+                       std::unique_ptr<pqxx::nontransaction> transaction,
+                       bool repeatable_read = false);
 
       bool apply(
           const shared_model::interface::Transaction &,
           std::function<bool(const shared_model::interface::Transaction &,
                              WsvQuery &)> function) override;
 
+      /**
+       * Open a new connection with the same options and apply all
+       * transactions applied to this wsv
+       */
+      expected::Result<std::unique_ptr<TemporaryWsv>, std::string> fork()
+          const override;
+
       ~TemporaryWsvImpl() override;
 
      private:
       std::unique_ptr<pqxx::lazyconnection> connection_;
       std::unique_ptr<pqxx::nontransaction> transaction_;
+      bool repeatable_read_;
       std::unique_ptr<WsvQuery> wsv_;
       std::unique_ptr<WsvCommand> executor_;
       std::shared_ptr<CommandExecutor> command_executor_;
       std::shared_ptr<CommandValidator> command_validator_;
+      /// successfully applied transactions, which are replayed by fork
+      std::vector<const shared_model::interface::Transaction *> applied_;
 
       logger::Logger log_;
     };
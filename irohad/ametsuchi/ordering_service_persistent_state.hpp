@@ -19,13 +19,24 @@
 #define IROHA_ORDERING_SERVICE_PERSISTENT_STATE_HPP
 
 #include <boost/optional.hpp>
+#include <memory>
+#include <vector>
+
+#include "cryptography/hash.hpp"
+
+namespace shared_model {
+  namespace interface {
+    class Transaction;
+  }  // namespace interface
+}  // namespace shared_model
 
 namespace iroha {
   namespace ametsuchi {
 
     /**
-     * Interface for Ordering Service persistence to store proposal's height in
-     * a persistent way
+     * Interface for Ordering Service persistence to store proposal's height
+     * and transactions waiting for proposal in a persistent way. It also
+     * stores the round of ordering gate of the peer
      */
     class OrderingServicePersistentState {
      public:
@@ -40,6 +51,44 @@ namespace iroha {
        */
       virtual boost::optional<size_t> loadProposalHeight() const = 0;
 
+      /**
+       * Save height of the last proposal passed to consensus by ordering
+       * gate, so that rounds skipped without a block can be restored after
+       * launch
+       * @param height - height of proposal
+       * @return true if height is saved
+       */
+      virtual bool savePassedProposalHeight(size_t height) = 0;
+
+      /**
+       * Load height of the last proposal passed to consensus by ordering gate
+       * @return saved height, 0 if nothing was passed
+       */
+      virtual boost::optional<size_t> loadPassedProposalHeight() const = 0;
+
+      /**
+       * Save transaction accepted to the queue, so that it can be restored
+       * after launch
+       * @param transaction - accepted transaction
+       * @return true if transaction is saved
+       */
+      virtual bool saveTransaction(
+          const shared_model::interface::Transaction &transaction) = 0;
+
+      /**
+       * Remove transactions which left the queue
+       * @param hashes - hashes of proposed or dropped transactions
+       * @return true if transactions are removed
+       */
+      virtual bool removeTransactions(
+          const std::vector<shared_model::crypto::Hash> &hashes) = 0;
+
+      /**
+       * Load saved transactions in order of acceptance
+       */
+      virtual std::vector<std::shared_ptr<shared_model::interface::Transaction>>
+      loadTransactions() const = 0;
+
       /**
        * Reset storage to default state
        */
@@ -21,6 +21,12 @@
 #include <memory>
 #include "common/result.hpp"
 
+namespace shared_model {
+  namespace interface {
+    class Block;
+  }  // namespace interface
+}  // namespace shared_model
+
 namespace iroha {
   namespace ametsuchi {
 
@@ -38,6 +44,20 @@ namespace iroha {
       virtual expected::Result<std::unique_ptr<TemporaryWsv>, std::string>
       createTemporaryWsv() = 0;
 
+      /**
+       * Creates a temporary world state view from the state after the given
+       * block, which may be not committed yet. The view reads a snapshot of
+       * the current state, and transactions of the block are applied to it
+       * unless the snapshot contains the block already. Commits of blocks
+       * wait until the view is destroyed, so the block is never applied
+       * twice.
+       * @param block - block with transactions, which passed validation. It
+       * should outlive the view, forks of which apply the same transactions
+       * @return Created Result with temporary wsv or string error
+       */
+      virtual expected::Result<std::unique_ptr<TemporaryWsv>, std::string>
+      createTemporaryWsv(const shared_model::interface::Block &block) = 0;
+
       virtual ~TemporaryFactory() = default;
     };
 
@@ -19,9 +19,12 @@
 #define IROHA_TEMPORARYWSV_HPP
 
 #include <functional>
+#include <memory>
+#include <string>
 
 #include "ametsuchi/wsv_command.hpp"
 #include "ametsuchi/wsv_query.hpp"
+#include "common/result.hpp"
 
 namespace shared_model {
   namespace interface {
@@ -56,6 +59,16 @@ namespace iroha {
           std::function<bool(const shared_model::interface::Transaction &,
                              WsvQuery &)> function) = 0;
 
+      /**
+       * Create temporary world state view with the same state, which can be
+       * used concurrently with this one. Transactions applied to one of them
+       * are not visible in the other. Transactions applied before the fork
+       * are not copied, and should outlive the call
+       * @return new temporary wsv or error message
+       */
+      virtual expected::Result<std::unique_ptr<TemporaryWsv>, std::string>
+      fork() const = 0;
+
       virtual ~TemporaryWsv() = default;
     };
   }  // namespace ametsuchi
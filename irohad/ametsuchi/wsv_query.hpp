@@ -20,6 +20,7 @@
 
 #include <boost/optional.hpp>
 #include <string>
+#include <utility>
 #include <vector>
 #include "common/types.hpp"
 
@@ -117,6 +118,29 @@ namespace iroha {
       getSignatories(
           const shared_model::interface::types::AccountIdType &account_id) = 0;
 
+      /**
+       * Get several accounts with a single query
+       * @param account_ids - ids of accounts
+       * @return existing accounts in arbitrary order
+       */
+      virtual boost::optional<
+          std::vector<std::shared_ptr<shared_model::interface::Account>>>
+      getAccounts(
+          const std::vector<shared_model::interface::types::AccountIdType>
+              &account_ids) = 0;
+
+      /**
+       * Get signatories of several accounts with a single query
+       * @param account_ids - ids of accounts
+       * @return pairs of account id and its signatory in arbitrary order
+       */
+      virtual boost::optional<
+          std::vector<std::pair<shared_model::interface::types::AccountIdType,
+                                shared_model::interface::types::PubkeyType>>>
+      getAccountsSignatories(
+          const std::vector<shared_model::interface::types::AccountIdType>
+              &account_ids) = 0;
+
       /**
        * Get asset by its name
        * @param asset_id
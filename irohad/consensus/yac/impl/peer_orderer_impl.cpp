@@ -20,6 +20,7 @@
 #include <random>
 
 #include "ametsuchi/peer_query.hpp"
+#include "common/byteutils.hpp"
 #include "common/types.hpp"
 #include "consensus/yac/cluster_order.hpp"
 #include "consensus/yac/yac_hash_provider.hpp"
@@ -40,7 +41,9 @@ namespace iroha {
       boost::optional<ClusterOrdering> PeerOrdererImpl::getOrdering(
           const YacHash &hash) {
         return query_->getLedgerPeers() | [&hash](auto peers) {
-          std::seed_seq seed(hash.block_hash.begin(), hash.block_hash.end());
+          // seeded with the hex string, so all versions agree on the order
+          auto hex_hash = bytestringToHexstring(hash.block_hash);
+          std::seed_seq seed(hex_hash.begin(), hex_hash.end());
           std::default_random_engine gen(seed);
           std::shuffle(peers.begin(), peers.end(), gen);
           return ClusterOrdering::create(peers);
@@ -16,23 +16,23 @@
  */
 
 #include "consensus/yac/impl/timer_impl.hpp"
-#include <iostream>
 
 namespace iroha {
   namespace consensus {
     namespace yac {
-      TimerImpl::TimerImpl(
-          std::function<rxcpp::observable<TimeoutType>()> invoke_delay)
-          : invoke_delay_(std::move(invoke_delay)) {}
+      TimerImpl::TimerImpl(std::shared_ptr<timer::TimerWheel> wheel,
+                           std::chrono::milliseconds delay)
+          : wheel_(std::move(wheel)), delay_(delay) {}
 
       void TimerImpl::invokeAfterDelay(std::function<void()> handler) {
-        deny();
-        handle_ = invoke_delay_().subscribe(
-            [handler{std::move(handler)}](auto) { handler(); });
+        std::lock_guard<std::mutex> lock(handle_mutex_);
+        handle_.cancel();
+        handle_ = wheel_->schedule(delay_, std::move(handler));
       }
 
       void TimerImpl::deny() {
-        handle_.unsubscribe();
+        std::lock_guard<std::mutex> lock(handle_mutex_);
+        handle_.cancel();
       }
 
       TimerImpl::~TimerImpl() {
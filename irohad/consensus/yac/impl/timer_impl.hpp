@@ -18,23 +18,25 @@
 #ifndef IROHA_TIMER_IMPL_HPP
 #define IROHA_TIMER_IMPL_HPP
 
-#include <rxcpp/rx.hpp>
+#include <chrono>
+#include <memory>
+#include <mutex>
+
 #include "consensus/yac/timer.hpp"
+#include "timer/timer_wheel.hpp"
 
 namespace iroha {
   namespace consensus {
     namespace yac {
       class TimerImpl : public Timer {
        public:
-        /// Delay observable type
-        using TimeoutType = long;
-
         /**
          * Constructor
-         * @param invoke_delay cold observable which specifies invoke strategy
+         * @param wheel - shared timer service which invokes handlers
+         * @param delay - delay before invocation of a handler
          */
-        explicit TimerImpl(
-            std::function<rxcpp::observable<TimeoutType>()> invoke_delay);
+        TimerImpl(std::shared_ptr<timer::TimerWheel> wheel,
+                  std::chrono::milliseconds delay);
         TimerImpl(const TimerImpl &) = delete;
         TimerImpl &operator=(const TimerImpl &) = delete;
 
@@ -44,8 +46,10 @@ namespace iroha {
         ~TimerImpl() override;
 
        private:
-        std::function<rxcpp::observable<TimeoutType>()> invoke_delay_;
-        rxcpp::composite_subscription handle_;
+        std::shared_ptr<timer::TimerWheel> wheel_;
+        std::chrono::milliseconds delay_;
+        timer::TimerHandle handle_;
+        std::mutex handle_mutex_;
       };
     }  // namespace yac
   }    // namespace consensus
@@ -19,6 +19,7 @@
 
 #include <utility>
 
+#include "common/byteutils.hpp"
 #include "common/types.hpp"
 #include "common/visitor.hpp"
 #include "consensus/yac/cluster_order.hpp"
@@ -72,6 +73,7 @@ namespace iroha {
             timer_(std::move(timer)),
             cluster_order_(order) {
         log_ = logger::log("YAC");
+        setClusterOrder(std::move(order));
       }
 
       // ------|Hash gate|------
@@ -81,7 +83,10 @@ namespace iroha {
                    logger::to_string(order.getPeers(),
                                      [](auto val) { return val->address(); }));
 
-        cluster_order_ = order;
+        {
+          std::lock_guard<std::mutex> guard(mutex_);
+          setClusterOrder(std::move(order));
+        }
         auto vote = crypto_->getVote(hash);
         votingStep(vote);
       }
@@ -92,33 +97,37 @@ namespace iroha {
 
       // ------|Network notifications|------
 
+      // Signatures are verified before taking mutex_, so messages received
+      // on different transport threads are verified in parallel, and only
+      // verified messages are applied to the state one at a time
+
       void Yac::on_vote(VoteMessage vote) {
-        std::lock_guard<std::mutex> guard(mutex_);
-        if (crypto_->verify(vote)) {
-          applyVote(findPeer(vote), vote);
-        } else {
+        if (not crypto_->verify(vote)) {
           log_->warn(cryptoError({vote}));
+          return;
         }
+        std::lock_guard<std::mutex> guard(mutex_);
+        applyVote(findPeer(vote), vote);
       }
 
       void Yac::on_commit(CommitMessage commit) {
-        std::lock_guard<std::mutex> guard(mutex_);
-        if (crypto_->verify(commit)) {
-          // Commit does not contain data about peer which sent the message
-          applyCommit(boost::none, commit);
-        } else {
+        if (not crypto_->verify(commit)) {
           log_->warn(cryptoError(commit.votes));
+          return;
         }
+        std::lock_guard<std::mutex> guard(mutex_);
+        // Commit does not contain data about peer which sent the message
+        applyCommit(boost::none, commit);
       }
 
       void Yac::on_reject(RejectMessage reject) {
-        std::lock_guard<std::mutex> guard(mutex_);
-        if (crypto_->verify(reject)) {
-          // Reject does not contain data about peer which sent the message
-          applyReject(boost::none, reject);
-        } else {
+        if (not crypto_->verify(reject)) {
           log_->warn(cryptoError(reject.votes));
+          return;
         }
+        std::lock_guard<std::mutex> guard(mutex_);
+        // Reject does not contain data about peer which sent the message
+        applyReject(boost::none, reject);
       }
 
       // ------|Private interface|------
@@ -130,8 +139,8 @@ namespace iroha {
         }
 
         log_->info("Vote for hash ({}, {})",
-                   vote.hash.proposal_hash,
-                   vote.hash.block_hash);
+                   bytestringToHexstring(vote.hash.proposal_hash),
+                   bytestringToHexstring(vote.hash.block_hash));
 
         network_->send_vote(cluster_order_.currentLeader(), vote);
         cluster_order_.switchToNext();
@@ -144,15 +153,21 @@ namespace iroha {
         timer_->deny();
       }
 
+      void Yac::setClusterOrder(ClusterOrdering order) {
+        cluster_order_ = std::move(order);
+        peers_by_key_.clear();
+        for (auto &peer : cluster_order_.getPeers()) {
+          auto key = shared_model::crypto::toBinaryString(peer->pubkey());
+          peers_by_key_.emplace(std::move(key), std::move(peer));
+        }
+      }
+
       boost::optional<std::shared_ptr<shared_model::interface::Peer>>
       Yac::findPeer(const VoteMessage &vote) {
-        auto peers = cluster_order_.getPeers();
-        auto it =
-            std::find_if(peers.begin(), peers.end(), [&](const auto &peer) {
-              return peer->pubkey() == vote.signature->publicKey();
-            });
-        return it != peers.end() ? boost::make_optional(std::move(*it))
-                                 : boost::none;
+        auto it = peers_by_key_.find(
+            shared_model::crypto::toBinaryString(vote.signature->publicKey()));
+        return it != peers_by_key_.end() ? boost::make_optional(it->second)
+                                         : boost::none;
       }
 
       // ------|Apply data|------
@@ -217,11 +232,11 @@ namespace iroha {
           const VoteMessage &vote) {
         if (from) {
           log_->info("Apply vote: {} from ledger peer {}",
-                     vote.hash.block_hash,
+                     bytestringToHexstring(vote.hash.block_hash),
                      (*from)->address());
         } else {
           log_->info("Apply vote: {} from unknown peer {}",
-                     vote.hash.block_hash,
+                     bytestringToHexstring(vote.hash.block_hash),
                      vote.signature->publicKey().hex());
         }
 
@@ -239,13 +254,15 @@ namespace iroha {
                            [&](const CommitMessage &commit) {
                              // propagate for all
                              log_->info("Propagate commit {} to whole network",
-                                        vote.hash.block_hash);
+                                        bytestringToHexstring(
+                                            vote.hash.block_hash));
                              this->propagateCommit(commit);
                              notifier_.get_subscriber().on_next(commit);
                            },
                            [&](const RejectMessage &reject) {
                              // propagate reject for all
-                             log_->info(kRejectOnHashMsg, proposal_hash);
+                             log_->info(kRejectOnHashMsg,
+                                        bytestringToHexstring(proposal_hash));
                              this->propagateReject(reject);
                            });
           } else {
@@ -253,12 +270,14 @@ namespace iroha {
               visit_in_place(answer,
                              [&](const CommitMessage &commit) {
                                log_->info("Propagate commit {} directly to {}",
-                                          vote.hash.block_hash,
+                                          bytestringToHexstring(
+                                              vote.hash.block_hash),
                                           from->address());
                                this->propagateCommitDirectly(*from, commit);
                              },
                              [&](const RejectMessage &reject) {
-                               log_->info(kRejectOnHashMsg, proposal_hash);
+                               log_->info(kRejectOnHashMsg,
+                                          bytestringToHexstring(proposal_hash));
                                this->propagateRejectDirectly(*from, reject);
                              });
             };
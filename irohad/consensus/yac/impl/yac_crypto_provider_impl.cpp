@@ -25,20 +25,47 @@ namespace iroha {
     namespace yac {
       CryptoProviderImpl::CryptoProviderImpl(
           const shared_model::crypto::Keypair &keypair)
-          : keypair_(keypair) {}
+          : keypair_(keypair), log_(logger::log("YacCryptoProvider")) {}
 
       bool CryptoProviderImpl::verify(CommitMessage msg) {
-        return std::all_of(
-            std::begin(msg.votes),
-            std::end(msg.votes),
-            [this](const auto &vote) { return this->verify(vote); });
+        return verify(msg.votes);
       }
 
       bool CryptoProviderImpl::verify(RejectMessage msg) {
-        return std::all_of(
-            std::begin(msg.votes),
-            std::end(msg.votes),
-            [this](const auto &vote) { return this->verify(vote); });
+        return verify(msg.votes);
+      }
+
+      bool CryptoProviderImpl::verify(const std::vector<VoteMessage> &votes) {
+        // votes of a certificate are mostly for the same hash, so each
+        // distinct hash is serialized once and shared by consecutive votes
+        std::vector<shared_model::crypto::Blob> payloads;
+        payloads.reserve(votes.size());
+        std::vector<
+            shared_model::crypto::DefaultCryptoAlgorithmType::SignedMessage>
+            messages;
+        messages.reserve(votes.size());
+        const VoteMessage *previous = nullptr;
+        for (const auto &vote : votes) {
+          if (previous == nullptr or previous->hash != vote.hash
+              or not(*previous->hash.block_signature
+                     == *vote.hash.block_signature)) {
+            payloads.emplace_back(PbConverters::serializeVotePayload(vote)
+                                      .hash()
+                                      .SerializeAsString());
+            previous = &vote;
+          }
+          messages.push_back({vote.signature->signedData(),
+                              payloads.back(),
+                              vote.signature->publicKey()});
+        }
+
+        auto invalid =
+            shared_model::crypto::CryptoVerifier<>::verifyBatch(messages);
+        for (auto i : invalid) {
+          log_->warn("Invalid signature of vote by {}",
+                     votes[i].signature->publicKey().hex());
+        }
+        return invalid.empty();
       }
 
       bool CryptoProviderImpl::verify(VoteMessage msg) {
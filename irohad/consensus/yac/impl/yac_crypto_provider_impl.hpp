@@ -18,8 +18,11 @@
 #ifndef IROHA_YAC_CRYPTO_PROVIDER_IMPL_HPP
 #define IROHA_YAC_CRYPTO_PROVIDER_IMPL_HPP
 
+#include <vector>
+
 #include "consensus/yac/yac_crypto_provider.hpp"
 #include "cryptography/keypair.hpp"
+#include "logger/logger.hpp"
 
 namespace iroha {
   namespace consensus {
@@ -38,7 +41,15 @@ namespace iroha {
         VoteMessage getVote(YacHash hash) override;
 
        private:
+        /**
+         * Verify signatures of votes in one batch
+         * @param votes - votes of commit or reject message
+         * @return true if all signatures are correct
+         */
+        bool verify(const std::vector<VoteMessage> &votes);
+
         shared_model::crypto::Keypair keypair_;
+        logger::Logger log_;
       };
     }  // namespace yac
   }    // namespace consensus
@@ -17,8 +17,11 @@
 
 #include "consensus/yac/impl/yac_gate_impl.hpp"
 
+#include <algorithm>
+
 #include "backend/protobuf/block.hpp"
 #include "builders/protobuf/common_objects/proto_signature_builder.hpp"
+#include "common/byteutils.hpp"
 #include "common/visitor.hpp"
 #include "consensus/yac/cluster_order.hpp"
 #include "consensus/yac/messages.hpp"
@@ -40,23 +43,27 @@ namespace iroha {
           std::shared_ptr<YacHashProvider> hash_provider,
           std::shared_ptr<simulator::BlockCreator> block_creator,
           std::shared_ptr<network::BlockLoader> block_loader,
-          uint64_t delay)
+          uint64_t delay,
+          size_t parallel_requests)
           : hash_gate_(std::move(hash_gate)),
             orderer_(std::move(orderer)),
             hash_provider_(std::move(hash_provider)),
             block_creator_(std::move(block_creator)),
             block_loader_(std::move(block_loader)),
-            delay_(delay) {
+            delay_(delay),
+            parallel_requests_(std::max<size_t>(parallel_requests, 1)) {
         log_ = logger::log("YacGate");
         block_creator_->on_block().subscribe(
             [this](const auto &block) { this->vote(block); });
       }
 
+      constexpr size_t YacGateImpl::kDefaultParallelRequests;
+
       void YacGateImpl::vote(
           const shared_model::interface::BlockVariant &block) {
         auto hash = hash_provider_->makeHash(block);
         log_->info("vote for block ({}, {})",
-                   hash.proposal_hash,
+                   bytestringToHexstring(hash.proposal_hash),
                    block.hash().toString());
         auto order = orderer_->getOrdering(hash);
         if (not order) {
@@ -93,18 +100,17 @@ namespace iroha {
             }
             // node has voted for another block - load committed block
             const auto model_hash = hash_provider_->toModelHash(hash.value());
-            // iterate over peers who voted for the committed block
-            rxcpp::observable<>::iterate(commit_message.votes)
+            // request peers who voted for the committed block
+            rxcpp::observable<>::just(commit_message.votes)
                 // allow other peers to apply commit
                 .delay(std::chrono::milliseconds(delay_))
-                .flat_map([this, model_hash](auto vote) {
-                  // map vote to block if it can be loaded
+                .flat_map([this, model_hash](auto votes) {
+                  // map votes to block if it can be loaded
                   return rxcpp::observable<>::create<
                       std::shared_ptr<shared_model::interface::Block>>(
-                      [this, model_hash, vote](auto subscriber) {
-                        auto block = block_loader_->retrieveBlock(
-                            vote.signature->publicKey(),
-                            shared_model::crypto::Hash(model_hash));
+                      [this, model_hash, votes](auto subscriber) {
+                        auto block = this->loadBlock(
+                            votes, shared_model::crypto::Hash(model_hash));
                         // if load is successful
                         if (block) {
                           subscriber.on_next(block.value());
@@ -137,6 +143,17 @@ namespace iroha {
                                              sig->publicKey());
         }
       }
+
+      boost::optional<std::shared_ptr<shared_model::interface::Block>>
+      YacGateImpl::loadBlock(const std::vector<VoteMessage> &votes,
+                             const shared_model::crypto::Hash &hash) {
+        std::vector<shared_model::crypto::PublicKey> voters;
+        voters.reserve(votes.size());
+        for (const auto &vote : votes) {
+          voters.push_back(vote.signature->publicKey());
+        }
+        return block_loader_->retrieveBlock(voters, hash, parallel_requests_);
+      }
     }  // namespace yac
   }    // namespace consensus
 }  // namespace iroha
@@ -20,9 +20,11 @@
 
 #include <memory>
 #include <rxcpp/rx-observable.hpp>
+#include <vector>
 
 #include "consensus/yac/yac_gate.hpp"
 #include "consensus/yac/yac_hash_provider.hpp"
+#include "cryptography/hash.hpp"
 #include "logger/logger.hpp"
 
 namespace iroha {
@@ -39,6 +41,7 @@ namespace iroha {
     namespace yac {
 
       struct CommitMessage;
+      struct VoteMessage;
       class YacPeerOrderer;
 
       class YacGateImpl : public YacGate {
@@ -48,7 +51,11 @@ namespace iroha {
                     std::shared_ptr<YacHashProvider> hash_provider,
                     std::shared_ptr<simulator::BlockCreator> block_creator,
                     std::shared_ptr<network::BlockLoader> block_loader,
-                    uint64_t delay);
+                    uint64_t delay,
+                    size_t parallel_requests = kDefaultParallelRequests);
+
+        /// default number of peers requested for a block at the same time
+        static constexpr size_t kDefaultParallelRequests = 3;
         void vote(const shared_model::interface::BlockVariant &) override;
         /**
          * method called when commit recived
@@ -65,6 +72,17 @@ namespace iroha {
          */
         void copySignatures(const CommitMessage &commit);
 
+        /**
+         * Load block from peers which voted for it. Up to parallel_requests_
+         * peers are requested at the same time by the block loader
+         * @param votes - votes for the block
+         * @param hash - hash of the block
+         * @return the block loaded first, none if no peer provided it
+         */
+        boost::optional<std::shared_ptr<shared_model::interface::Block>>
+        loadBlock(const std::vector<VoteMessage> &votes,
+                  const shared_model::crypto::Hash &hash);
+
         std::shared_ptr<HashGate> hash_gate_;
         std::shared_ptr<YacPeerOrderer> orderer_;
         std::shared_ptr<YacHashProvider> hash_provider_;
@@ -72,6 +90,7 @@ namespace iroha {
         std::shared_ptr<network::BlockLoader> block_loader_;
 
         const uint64_t delay_;
+        const size_t parallel_requests_;
 
         logger::Logger log_;
 
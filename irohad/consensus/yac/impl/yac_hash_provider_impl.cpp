@@ -24,9 +24,9 @@ namespace iroha {
       YacHash YacHashProviderImpl::makeHash(
           const shared_model::interface::BlockVariant &block_variant) const {
         YacHash result;
-        auto hex_hash = block_variant.hash().hex();
-        result.proposal_hash = hex_hash;
-        result.block_hash = hex_hash;
+        auto hash = shared_model::crypto::toBinaryString(block_variant.hash());
+        result.proposal_hash = hash;
+        result.block_hash = hash;
         const auto &sig = *block_variant.signatures().begin();
         result.block_signature = clone(sig);
         return result;
@@ -34,9 +34,7 @@ namespace iroha {
 
       shared_model::interface::types::HashType YacHashProviderImpl::toModelHash(
           const YacHash &hash) const {
-        auto blob = shared_model::crypto::Blob::fromHexString(hash.block_hash);
-        auto string_blob = shared_model::crypto::toBinaryString(blob);
-        return shared_model::interface::types::HashType(string_blob);
+        return shared_model::interface::types::HashType(hash.block_hash);
       }
     }  // namespace yac
   }    // namespace consensus
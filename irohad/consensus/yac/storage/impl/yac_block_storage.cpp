@@ -16,6 +16,8 @@
  */
 #include "consensus/yac/storage/yac_block_storage.hpp"
 
+#include "common/byteutils.hpp"
+
 using namespace logger;
 
 namespace iroha {
@@ -36,11 +38,13 @@ namespace iroha {
 
       boost::optional<Answer> YacBlockStorage::insert(VoteMessage msg) {
         if (validScheme(msg) and uniqueVote(msg)) {
+          voted_peers_.insert(
+              shared_model::crypto::toBinaryString(msg.signature->publicKey()));
           votes_.push_back(msg);
 
           log_->info("Vote ({}, {}) inserted",
-                     msg.hash.proposal_hash,
-                     msg.hash.block_hash);
+                     bytestringToHexstring(msg.hash.proposal_hash),
+                     bytestringToHexstring(msg.hash.block_hash));
           log_->info(
               "Votes in storage [{}/{}]", votes_.size(), peers_in_round_);
         }
@@ -49,8 +53,8 @@ namespace iroha {
 
       boost::optional<Answer> YacBlockStorage::insert(
           std::vector<VoteMessage> votes) {
-        std::for_each(votes.begin(), votes.end(), [this](auto vote) {
-          this->insert(vote);
+        std::for_each(votes.begin(), votes.end(), [this](auto &vote) {
+          this->insert(std::move(vote));
         });
         return getState();
       }
@@ -83,10 +87,9 @@ namespace iroha {
       // --------| private api |--------
 
       bool YacBlockStorage::uniqueVote(VoteMessage &msg) {
-        // lookup take O(n) times
-        return std::all_of(votes_.begin(), votes_.end(), [&msg](auto vote) {
-          return vote != msg;
-        });
+        return voted_peers_.count(shared_model::crypto::toBinaryString(
+                   msg.signature->publicKey()))
+            == 0;
       }
 
       bool YacBlockStorage::validScheme(VoteMessage &vote) {
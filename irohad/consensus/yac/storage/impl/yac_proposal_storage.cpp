@@ -17,6 +17,8 @@
 
 #include "consensus/yac/storage/yac_proposal_storage.hpp"
 
+#include "common/byteutils.hpp"
+
 using namespace logger;
 
 namespace iroha {
@@ -25,26 +27,19 @@ namespace iroha {
 
       // --------| private api |--------
 
-      auto YacProposalStorage::findStore(ProposalHash proposal_hash,
-                                         BlockHash block_hash) {
+      YacBlockStorage &YacProposalStorage::findStore(
+          const ProposalHash &proposal_hash, const BlockHash &block_hash) {
         // find exist
-        auto iter =
-            std::find_if(block_storages_.begin(),
-                         block_storages_.end(),
-                         [&proposal_hash, &block_hash](auto block_storage) {
-                           auto yac_hash = block_storage.getStorageHash();
-                           return yac_hash.proposal_hash == proposal_hash
-                               and yac_hash.block_hash == block_hash;
-                         });
-        if (iter != block_storages_.end()) {
-          return iter;
+        auto index = block_indices_.find(block_hash);
+        if (index != block_indices_.end()) {
+          return block_storages_[index->second];
         }
         // insert and return new
-        return block_storages_.emplace(
-            block_storages_.end(),
-            YacHash(proposal_hash, block_hash),
-            peers_in_round_,
-            supermajority_checker_);
+        block_indices_.emplace(block_hash, block_storages_.size());
+        block_storages_.emplace_back(YacHash(proposal_hash, block_hash),
+                                     peers_in_round_,
+                                     supermajority_checker_);
+        return block_storages_.back();
       }
 
       // --------| public api |--------
@@ -65,11 +60,13 @@ namespace iroha {
           // insert to block store
 
           log_->info("Vote [{}, {}] looks valid",
-                     msg.hash.proposal_hash,
-                     msg.hash.block_hash);
+                     bytestringToHexstring(msg.hash.proposal_hash),
+                     bytestringToHexstring(msg.hash.block_hash));
 
-          auto iter = findStore(msg.hash.proposal_hash, msg.hash.block_hash);
-          auto block_state = iter->insert(msg);
+          auto &store = findStore(msg.hash.proposal_hash, msg.hash.block_hash);
+          auto block_state = store.insert(msg);
+          voted_peers_.insert(
+              shared_model::crypto::toBinaryString(msg.signature->publicKey()));
 
           // Single BlockStorage always returns CommitMessage because it
           // aggregates votes for a single hash.
@@ -90,7 +87,7 @@ namespace iroha {
 
       boost::optional<Answer> YacProposalStorage::insert(
           std::vector<VoteMessage> messages) {
-        std::for_each(messages.begin(), messages.end(), [this](auto vote) {
+        std::for_each(messages.begin(), messages.end(), [this](auto &vote) {
           this->insert(std::move(vote));
         });
         return getState();
@@ -106,25 +103,13 @@ namespace iroha {
       // --------| private api |--------
 
       bool YacProposalStorage::shouldInsert(const VoteMessage &msg) {
-        return checkProposalHash(msg.hash.proposal_hash)
-            and checkPeerUniqueness(msg);
+        return checkProposalHash(msg.hash.proposal_hash);
       }
 
       bool YacProposalStorage::checkProposalHash(ProposalHash vote_hash) {
         return vote_hash == hash_;
       }
 
-      bool YacProposalStorage::checkPeerUniqueness(const VoteMessage &msg) {
-        return std::all_of(block_storages_.begin(),
-                           block_storages_.end(),
-                           [&msg](YacBlockStorage &storage) {
-                             if (storage.getStorageHash() != msg.hash) {
-                               return true;
-                             }
-                             return not storage.isContains(msg);
-                           });
-      }
-
       boost::optional<Answer> YacProposalStorage::findRejectProof() {
         auto max_vote = std::max_element(block_storages_.begin(),
                                          block_storages_.end(),
@@ -142,8 +127,9 @@ namespace iroha {
                               return acc + storage.getNumberOfVotes();
                             });
 
+        // a peer may vote for several blocks, so count it as voted once
         auto is_reject = supermajority_checker_->hasReject(
-            max_vote, all_votes, peers_in_round_);
+            max_vote, voted_peers_.size(), peers_in_round_);
 
         if (is_reject) {
           std::vector<VoteMessage> result;
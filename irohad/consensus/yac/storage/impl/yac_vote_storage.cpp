@@ -28,32 +28,45 @@ namespace iroha {
 
       // --------| private api |--------
 
-      auto YacVoteStorage::getProposalStorage(ProposalHash hash) {
-        return std::find_if(proposal_storages_.begin(),
-                            proposal_storages_.end(),
-                            [&hash](auto storage) {
-                              return storage.getProposalHash() == hash;
-                            });
+      YacVoteStorage::Rounds::iterator YacVoteStorage::getProposalStorage(
+          const ProposalHash &hash) {
+        return proposal_storages_.find(hash);
       }
 
-      auto YacVoteStorage::findProposalStorage(const VoteMessage &msg,
-                                               uint64_t peers_in_round) {
+      YacVoteStorage::Rounds::iterator YacVoteStorage::findProposalStorage(
+          const VoteMessage &msg, uint64_t peers_in_round) {
         auto val = getProposalStorage(msg.hash.proposal_hash);
         if (val != proposal_storages_.end()) {
           return val;
         }
-        return proposal_storages_.emplace(
-            proposal_storages_.end(),
-            msg.hash.proposal_hash,
-            peers_in_round,
-            std::make_shared<SupermajorityCheckerImpl>());
+        creation_order_.push_back(msg.hash.proposal_hash);
+        return proposal_storages_
+            .emplace(msg.hash.proposal_hash,
+                     Round{next_sequence_++,
+                           YacProposalStorage(
+                               msg.hash.proposal_hash,
+                               peers_in_round,
+                               std::make_shared<SupermajorityCheckerImpl>())})
+            .first;
       }
 
       // --------| public api |--------
 
+      constexpr size_t YacVoteStorage::kDefaultRetainedRounds;
+      constexpr size_t YacVoteStorage::kEvictedRoundsLimit;
+
+      YacVoteStorage::YacVoteStorage(size_t retained_rounds)
+          : retained_rounds_(std::max<size_t>(retained_rounds, 1)) {}
+
       boost::optional<Answer> YacVoteStorage::store(VoteMessage vote,
                                                      uint64_t peers_in_round) {
-        return findProposalStorage(vote, peers_in_round)->insert(vote);
+        if (evicted_rounds_.count(vote.hash.proposal_hash) != 0) {
+          return boost::none;
+        }
+        auto round = findProposalStorage(vote, peers_in_round);
+        auto was_decided = bool(round->second.storage.getState());
+        round->second.storage.insert(std::move(vote));
+        return updateRounds(round, was_decided);
       }
 
       boost::optional<Answer> YacVoteStorage::store(CommitMessage commit,
@@ -67,11 +80,11 @@ namespace iroha {
       }
 
       bool YacVoteStorage::isHashCommitted(ProposalHash hash) {
-        auto iter = getProposalStorage(std::move(hash));
+        auto iter = getProposalStorage(hash);
         if (iter == proposal_storages_.end()) {
           return false;
         }
-        return bool(iter->getState());
+        return bool(iter->second.storage.getState());
       }
 
       bool YacVoteStorage::getProcessingState(const ProposalHash &hash) {
@@ -82,16 +95,61 @@ namespace iroha {
         processing_state_.insert(hash);
       }
 
+      size_t YacVoteStorage::getNumberOfRounds() const {
+        return proposal_storages_.size();
+      }
+
       // --------| private api |--------
 
       boost::optional<Answer> YacVoteStorage::insert_votes(
           std::vector<VoteMessage> &votes, uint64_t peers_in_round) {
-        if (not sameProposals(votes)) {
+        if (not sameProposals(votes)
+            or evicted_rounds_.count(votes.at(0).hash.proposal_hash) != 0) {
           return boost::none;
         }
 
-        auto storage = findProposalStorage(votes.at(0), peers_in_round);
-        return storage->insert(votes);
+        auto round = findProposalStorage(votes.at(0), peers_in_round);
+        auto was_decided = bool(round->second.storage.getState());
+        round->second.storage.insert(std::move(votes));
+        return updateRounds(round, was_decided);
+      }
+
+      boost::optional<Answer> YacVoteStorage::updateRounds(
+          Rounds::iterator round, bool was_decided) {
+        auto state = round->second.storage.getState();
+        if (not state or was_decided) {
+          return state;
+        }
+
+        decided_rounds_.push_back(round->second.sequence);
+        if (decided_rounds_.size() <= retained_rounds_) {
+          return state;
+        }
+
+        // evict the oldest decided round with all rounds created before it
+        auto oldest = decided_rounds_.front();
+        decided_rounds_.pop_front();
+        while (not creation_order_.empty()) {
+          auto evicted = proposal_storages_.find(creation_order_.front());
+          if (evicted->second.sequence > oldest) {
+            break;
+          }
+          evict(evicted);
+          creation_order_.pop_front();
+        }
+        return state;
+      }
+
+      void YacVoteStorage::evict(Rounds::iterator round) {
+        if (evicted_rounds_.insert(round->first).second) {
+          eviction_order_.push_back(round->first);
+        }
+        if (eviction_order_.size() > kEvictedRoundsLimit) {
+          evicted_rounds_.erase(eviction_order_.front());
+          eviction_order_.pop_front();
+        }
+        processing_state_.erase(round->first);
+        proposal_storages_.erase(round);
       }
 
     }  // namespace yac
@@ -20,6 +20,7 @@
 
 #include <memory>
 #include <boost/optional.hpp>
+#include <unordered_set>
 #include <vector>
 
 #include "consensus/yac/impl/supermajority_checker_impl.hpp"
@@ -43,6 +44,11 @@ namespace iroha {
          */
         std::vector<VoteMessage> votes_;
 
+        /**
+         * Public keys of peers whose votes are stored
+         */
+        std::unordered_set<std::string> voted_peers_;
+
        public:
         YacBlockStorage(
             YacHash hash,
@@ -97,9 +103,9 @@ namespace iroha {
         // --------| private api |--------
 
         /**
-         * Verify uniqueness of vote in storage
+         * Verify that peer has no vote in storage
          * @param msg - vote for verification
-         * @return true if vote doesn't appear in storage
+         * @return true if vote of this peer doesn't appear in storage
          */
         bool uniqueVote(VoteMessage &vote);
 
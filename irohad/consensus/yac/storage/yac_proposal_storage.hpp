@@ -20,6 +20,8 @@
 
 #include <memory>
 #include <boost/optional.hpp>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include "consensus/yac/impl/supermajority_checker_impl.hpp"
@@ -43,13 +45,14 @@ namespace iroha {
         // --------| private api |--------
 
         /**
-         * Find block index with provided parameters,
+         * Find block storage with provided parameters,
          * if those store absent - create new
          * @param proposal_hash - hash of proposal
          * @param block_hash - hash of block
-         * @return iterator to storage
+         * @return reference to storage
          */
-        auto findStore(ProposalHash proposal_hash, BlockHash block_hash);
+        YacBlockStorage &findStore(const ProposalHash &proposal_hash,
+                                   const BlockHash &block_hash);
 
        public:
         // --------| public api |--------
@@ -104,12 +107,6 @@ namespace iroha {
          */
         bool checkProposalHash(ProposalHash vote_hash);
 
-        /**
-         * Is this peer first time appear in this proposal storage
-         * @return true, if peer unique
-         */
-        bool checkPeerUniqueness(const VoteMessage &msg);
-
         /**
          * Method try to find proof of reject.
          * This computes as
@@ -130,6 +127,18 @@ namespace iroha {
          */
         std::vector<YacBlockStorage> block_storages_;
 
+        /**
+         * Indices of block storages by block hash
+         */
+        std::unordered_map<BlockHash, size_t> block_indices_;
+
+        /**
+         * Public keys of peers which voted for this proposal. Votes of a peer
+         * are deduplicated per block by block storages, the set only counts
+         * voted peers for the reject proof
+         */
+        std::unordered_set<std::string> voted_peers_;
+
         /**
          * Hash of proposal
          */
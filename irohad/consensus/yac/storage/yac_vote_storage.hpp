@@ -18,33 +18,48 @@
 #ifndef IROHA_YAC_VOTE_STORAGE_HPP
 #define IROHA_YAC_VOTE_STORAGE_HPP
 
+#include <deque>
 #include <memory>
 #include <boost/optional.hpp>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
 #include "consensus/yac/messages.hpp"  // because messages passed by value
 #include "consensus/yac/storage/storage_result.hpp"  // for Answer
 #include "consensus/yac/storage/yac_common.hpp"      // for ProposalHash
+#include "consensus/yac/storage/yac_proposal_storage.hpp"
 
 namespace iroha {
   namespace consensus {
     namespace yac {
-      class YacProposalStorage;
 
       /**
        * Class provide storage for votes and useful methods for it.
+       * Storages of rounds are evicted when more than retained_rounds
+       * newer rounds are decided. Messages for the latest evicted rounds are
+       * dropped, so that those rounds are not decided again.
        */
       class YacVoteStorage {
        private:
+        /**
+         * Proposal storage with sequence number of its creation
+         */
+        struct Round {
+          uint64_t sequence;
+          YacProposalStorage storage;
+        };
+
+        using Rounds = std::unordered_map<ProposalHash, Round>;
+
         // --------| private api |--------
 
         /**
          * Retrieve iterator for storage with parameters hash
          * @param hash - object for finding
-         * @return iterator to proposal storage
+         * @return iterator to round, end if absent
          */
-        auto getProposalStorage(ProposalHash hash);
+        Rounds::iterator getProposalStorage(const ProposalHash &hash);
 
         /**
          * Find existed proposal storage or create new if required
@@ -52,19 +67,33 @@ namespace iroha {
          * @param peers_in_round - number of peer required
          * for verify supermajority;
          * This parameter used on creation of proposal storage
-         * @return - iter for required proposal storage
+         * @return - iter for required round
          */
-        auto findProposalStorage(const VoteMessage &msg,
-                                 uint64_t peers_in_round);
+        Rounds::iterator findProposalStorage(const VoteMessage &msg,
+                                             uint64_t peers_in_round);
 
        public:
         // --------| public api |--------
 
+        /// default number of decided rounds kept in storage
+        static constexpr size_t kDefaultRetainedRounds = 10;
+
+        /// number of the latest evicted rounds, messages for which are dropped
+        static constexpr size_t kEvictedRoundsLimit = 1000;
+
+        /**
+         * @param retained_rounds - number of the latest decided rounds kept
+         * in storage, at least one; older rounds are evicted
+         */
+        explicit YacVoteStorage(
+            size_t retained_rounds = kDefaultRetainedRounds);
+
         /**
          * Insert vote in storage
          * @param msg - current vote message
          * @param peers_in_round - number of peers participated in round
-         * @return structure with result of inserting. Nullopt if mgs not valid.
+         * @return structure with result of inserting. Nullopt if mgs not valid
+         * or its round is evicted.
          */
         boost::optional<Answer> store(VoteMessage msg,
                                        uint64_t peers_in_round);
@@ -74,7 +103,7 @@ namespace iroha {
          * @param commit - message with votes
          * @param peers_in_round - number of peers in current consensus round
          * @return structure with result of inserting.
-         * Nullopt if commit not valid.
+         * Nullopt if commit not valid or its round is evicted.
          */
         boost::optional<Answer> store(CommitMessage commit,
                                        uint64_t peers_in_round);
@@ -84,7 +113,7 @@ namespace iroha {
          * @param reject - message with votes
          * @param peers_in_round - number of peers in current consensus round
          * @return structure with result of inserting.
-         * Nullopt if reject not valid.
+         * Nullopt if reject not valid or its round is evicted.
          */
         boost::optional<Answer> store(RejectMessage reject,
                                        uint64_t peers_in_round);
@@ -109,6 +138,11 @@ namespace iroha {
          */
         void markAsProcessedState(const ProposalHash &hash);
 
+        /**
+         * @return number of rounds in storage
+         */
+        size_t getNumberOfRounds() const;
+
        private:
         // --------| private api |--------
 
@@ -121,18 +155,64 @@ namespace iroha {
         boost::optional<Answer> insert_votes(std::vector<VoteMessage> &votes,
                                               uint64_t peers_in_round);
 
+        /**
+         * Register the round as decided if insertion decided it, and evict
+         * rounds which are older than retained decided rounds
+         * @param round - round where votes were inserted
+         * @param was_decided - whether the round was decided before insertion
+         * @return state of the round
+         */
+        boost::optional<Answer> updateRounds(Rounds::iterator round,
+                                             bool was_decided);
+
+        /**
+         * Remove round from storage and remember it as evicted
+         * @param round - round for eviction
+         */
+        void evict(Rounds::iterator round);
+
         // --------| fields |--------
 
+        /**
+         * Number of the latest decided rounds kept in storage
+         */
+        size_t retained_rounds_;
+
+        /**
+         * Sequence number of the next created round
+         */
+        uint64_t next_sequence_{0};
+
         /**
          * Active proposal storages
          */
-        std::vector<YacProposalStorage> proposal_storages_;
+        Rounds proposal_storages_;
+
+        /**
+         * Hashes of rounds in order of creation
+         */
+        std::deque<ProposalHash> creation_order_;
+
+        /**
+         * Sequence numbers of decided rounds in order of decision
+         */
+        std::deque<uint64_t> decided_rounds_;
 
         /**
          * Processing set provide user flags about processing some hashes.
          * If hash exists <=> processed
          */
         std::unordered_set<ProposalHash> processing_state_;
+
+        /**
+         * Hashes of the latest evicted rounds in order of eviction
+         */
+        std::deque<ProposalHash> eviction_order_;
+
+        /**
+         * Hashes of the latest evicted rounds
+         */
+        std::unordered_set<ProposalHash> evicted_rounds_;
       };
 
     }  // namespace yac
@@ -54,26 +54,45 @@ namespace iroha {
 
         call->response_reader->Finish(&call->reply, &call->status, call);
 
-        log_->info("Send vote {} to {}", vote.hash.block_hash, to.address());
+        log_->info("Send vote {} to {}",
+                   bytestringToHexstring(vote.hash.block_hash),
+                   to.address());
       }
 
       void NetworkImpl::send_commit(const shared_model::interface::Peer &to,
                                     const CommitMessage &commit) {
         createPeerConnection(to);
+        auto &stub = *peers_.at(to.address());
 
-        proto::Commit request;
-        for (const auto &vote : commit.votes) {
-          auto pb_vote = request.add_votes();
-          *pb_vote = PbConverters::serializeVote(vote);
+        bool legacy;
+        {
+          std::lock_guard<std::mutex> lock(legacy_peers_mutex_);
+          legacy = legacy_peers_.count(to.address()) != 0;
+        }
+        auto compact = legacy
+            ? boost::none
+            : PbConverters::serializeCompactCommit(commit);
+        if (not compact) {
+          sendFullCommit(stub, commit);
+        } else {
+          auto call = new AsyncClientCall;
+          // peers which do not know compact commits receive full votes
+          call->on_finish = [this, &stub, commit, address = to.address()](
+                                const grpc::Status &status) {
+            if (status.error_code() == grpc::StatusCode::UNIMPLEMENTED) {
+              {
+                std::lock_guard<std::mutex> lock(legacy_peers_mutex_);
+                legacy_peers_.insert(address);
+              }
+              this->sendFullCommit(stub, commit);
+            }
+          };
+
+          call->response_reader =
+              stub.AsyncSendCompactCommit(&call->context, *compact, &cq_);
+
+          call->response_reader->Finish(&call->reply, &call->status, call);
         }
-
-        auto call = new AsyncClientCall;
-
-        call->response_reader =
-            peers_.at(to.address())
-                ->AsyncSendCommit(&call->context, request, &cq_);
-
-        call->response_reader->Finish(&call->reply, &call->status, call);
 
         log_->info("Send votes bundle[size={}] commit to {}",
                    commit.votes.size(),
@@ -107,12 +126,18 @@ namespace iroha {
           ::grpc::ServerContext *context,
           const ::iroha::consensus::yac::proto::Vote *request,
           ::google::protobuf::Empty *response) {
-        auto vote = *PbConverters::deserializeVote(*request);
+        auto vote = PbConverters::deserializeVote(*request);
+        if (not vote) {
+          log_->warn("Receive malformed vote from {}", context->peer());
+          return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+                              "malformed vote");
+        }
 
-        log_->info(
-            "Receive vote {} from {}", vote.hash.block_hash, context->peer());
+        log_->info("Receive vote {} from {}",
+                   bytestringToHexstring(vote->hash.block_hash),
+                   context->peer());
 
-        handler_.lock()->on_vote(vote);
+        handler_.lock()->on_vote(*vote);
         return grpc::Status::OK;
       }
 
@@ -122,8 +147,13 @@ namespace iroha {
           ::google::protobuf::Empty *response) {
         CommitMessage commit(std::vector<VoteMessage>{});
         for (const auto &pb_vote : request->votes()) {
-          auto vote = *PbConverters::deserializeVote(pb_vote);
-          commit.votes.push_back(vote);
+          auto vote = PbConverters::deserializeVote(pb_vote);
+          if (not vote) {
+            log_->warn("Receive malformed commit from {}", context->peer());
+            return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+                                "malformed commit");
+          }
+          commit.votes.push_back(std::move(*vote));
         }
 
         log_->info("Receive commit[size={}] from {}",
@@ -134,14 +164,39 @@ namespace iroha {
         return grpc::Status::OK;
       }
 
+      grpc::Status NetworkImpl::SendCompactCommit(
+          ::grpc::ServerContext *context,
+          const ::iroha::consensus::yac::proto::CompactCommit *request,
+          ::google::protobuf::Empty *response) {
+        auto commit = PbConverters::deserializeCompactCommit(*request);
+        if (not commit) {
+          log_->warn("Receive malformed compact commit from {}",
+                     context->peer());
+          return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+                              "malformed compact commit");
+        }
+
+        log_->info("Receive compact commit[size={}] from {}",
+                   commit->votes.size(),
+                   context->peer());
+
+        handler_.lock()->on_commit(*commit);
+        return grpc::Status::OK;
+      }
+
       grpc::Status NetworkImpl::SendReject(
           ::grpc::ServerContext *context,
           const ::iroha::consensus::yac::proto::Reject *request,
           ::google::protobuf::Empty *response) {
         RejectMessage reject(std::vector<VoteMessage>{});
         for (const auto &pb_vote : request->votes()) {
-          auto vote = *PbConverters::deserializeVote(pb_vote);
-          reject.votes.push_back(vote);
+          auto vote = PbConverters::deserializeVote(pb_vote);
+          if (not vote) {
+            log_->warn("Receive malformed reject from {}", context->peer());
+            return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+                                "malformed reject");
+          }
+          reject.votes.push_back(std::move(*vote));
         }
 
         log_->info("Receive reject[size={}] from {}",
@@ -152,6 +207,22 @@ namespace iroha {
         return grpc::Status::OK;
       }
 
+      void NetworkImpl::sendFullCommit(proto::Yac::Stub &stub,
+                                       const CommitMessage &commit) {
+        proto::Commit request;
+        for (const auto &vote : commit.votes) {
+          auto pb_vote = request.add_votes();
+          *pb_vote = PbConverters::serializeVote(vote);
+        }
+
+        auto call = new AsyncClientCall;
+
+        call->response_reader =
+            stub.AsyncSendCommit(&call->context, request, &cq_);
+
+        call->response_reader->Finish(&call->reply, &call->status, call);
+      }
+
       void NetworkImpl::createPeerConnection(
           const shared_model::interface::Peer &peer) {
         if (peers_.count(peer.address()) == 0) {
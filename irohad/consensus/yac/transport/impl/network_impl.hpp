@@ -19,7 +19,9 @@
 #define IROHA_NETWORK_IMPL_HPP
 
 #include <memory>
+#include <mutex>
 #include <unordered_map>
+#include <unordered_set>
 
 #include "consensus/yac/transport/yac_network_interface.hpp"  // for YacNetwork
 #include "interfaces/common_objects/types.hpp"
@@ -72,6 +74,14 @@ namespace iroha {
             const ::iroha::consensus::yac::proto::Commit *request,
             ::google::protobuf::Empty *response) override;
 
+        /**
+         * Receive commit in compact form from another peer
+         */
+        grpc::Status SendCompactCommit(
+            ::grpc::ServerContext *context,
+            const ::iroha::consensus::yac::proto::CompactCommit *request,
+            ::google::protobuf::Empty *response) override;
+
         /**
          * Receive reject from another peer;
          * Naming is confusing, because this is rpc call that
@@ -90,6 +100,14 @@ namespace iroha {
          */
         void createPeerConnection(const shared_model::interface::Peer &peer);
 
+        /**
+         * Send commit as a list of full votes
+         * @param stub - connection to recipient
+         * @param commit - commit to send
+         */
+        void sendFullCommit(proto::Yac::Stub &stub,
+                            const CommitMessage &commit);
+
         /**
          * Mapping of peer objects to connections
          */
@@ -101,6 +119,13 @@ namespace iroha {
          * Subscriber of network messages
          */
         std::weak_ptr<YacNetworkNotifications> handler_;
+
+        /**
+         * Addresses of peers which do not support compact commits
+         */
+        std::unordered_set<shared_model::interface::types::AddressType>
+            legacy_peers_;
+        std::mutex legacy_peers_mutex_;
       };
 
     }  // namespace yac
@@ -35,8 +35,8 @@ namespace iroha {
           proto::Vote pb_vote;
 
           auto hash = pb_vote.mutable_hash();
-          hash->set_block(vote.hash.block_hash);
-          hash->set_proposal(vote.hash.proposal_hash);
+          hash->set_block(serializeHash(vote.hash.block_hash));
+          hash->set_proposal(serializeHash(vote.hash.proposal_hash));
 
           auto block_signature = hash->mutable_block_signature();
 
@@ -53,8 +53,8 @@ namespace iroha {
           proto::Vote pb_vote;
 
           auto hash = pb_vote.mutable_hash();
-          hash->set_block(vote.hash.block_hash);
-          hash->set_proposal(vote.hash.proposal_hash);
+          hash->set_block(serializeHash(vote.hash.block_hash));
+          hash->set_proposal(serializeHash(vote.hash.proposal_hash));
 
           auto block_signature = hash->mutable_block_signature();
 
@@ -76,9 +76,16 @@ namespace iroha {
 
         static boost::optional<VoteMessage> deserializeVote(
             const proto::Vote &pb_vote) {
+          auto proposal_hash = deserializeHash(pb_vote.hash().proposal());
+          auto block_hash = deserializeHash(pb_vote.hash().block());
+          if (not proposal_hash or not block_hash) {
+            logger::log("YacPbConverter::deserializeVote")
+                ->error("Cannot decode vote hash");
+            return boost::none;
+          }
           VoteMessage vote;
-          vote.hash.proposal_hash = pb_vote.hash().proposal();
-          vote.hash.block_hash = pb_vote.hash().block();
+          vote.hash.proposal_hash = std::move(*proposal_hash);
+          vote.hash.block_hash = std::move(*block_hash);
 
           shared_model::builder::DefaultSignatureBuilder()
               .publicKey(shared_model::crypto::PublicKey(
@@ -119,6 +126,111 @@ namespace iroha {
 
           return vote;
         }
+
+        /**
+         * Serialize commit, sending hashes and public key of each voter once
+         * @param commit - commit to serialize
+         * @return compact commit, or none if votes are for different hashes
+         * or some voter signed the block with another key
+         */
+        static boost::optional<proto::CompactCommit> serializeCompactCommit(
+            const CommitMessage &commit) {
+          if (commit.votes.empty()) {
+            return boost::none;
+          }
+          const auto &hash = commit.votes.front().hash;
+          proto::CompactCommit pb_commit;
+          pb_commit.set_proposal(serializeHash(hash.proposal_hash));
+          pb_commit.set_block(serializeHash(hash.block_hash));
+          for (const auto &vote : commit.votes) {
+            const auto &block_signature = *vote.hash.block_signature;
+            const auto &signature = *vote.signature;
+            if (vote.hash != hash
+                or not(block_signature.publicKey() == signature.publicKey())) {
+              return boost::none;
+            }
+            auto voter = pb_commit.add_voters();
+            voter->set_pubkey(
+                shared_model::crypto::toBinaryString(signature.publicKey()));
+            voter->set_block_signature(shared_model::crypto::toBinaryString(
+                block_signature.signedData()));
+            voter->set_vote_signature(
+                shared_model::crypto::toBinaryString(signature.signedData()));
+          }
+          return pb_commit;
+        }
+
+        static boost::optional<CommitMessage> deserializeCompactCommit(
+            const proto::CompactCommit &pb_commit) {
+          auto proposal_hash = deserializeHash(pb_commit.proposal());
+          auto block_hash = deserializeHash(pb_commit.block());
+          if (not proposal_hash or not block_hash) {
+            return boost::none;
+          }
+          CommitMessage commit(std::vector<VoteMessage>{});
+          for (const auto &voter : pb_commit.voters()) {
+            VoteMessage vote;
+            vote.hash.proposal_hash = *proposal_hash;
+            vote.hash.block_hash = *block_hash;
+            shared_model::crypto::PublicKey pubkey(voter.pubkey());
+            vote.hash.block_signature = deserializeSignature(
+                pubkey, shared_model::crypto::Signed(voter.block_signature()));
+            vote.signature = deserializeSignature(
+                pubkey, shared_model::crypto::Signed(voter.vote_signature()));
+            if (not vote.hash.block_signature or not vote.signature) {
+              return boost::none;
+            }
+            commit.votes.push_back(std::move(vote));
+          }
+          if (commit.votes.empty()) {
+            return boost::none;
+          }
+          return commit;
+        }
+
+       private:
+        /**
+         * Hashes are sent and signed as hex strings, so peers of previous
+         * versions accept the messages and verify their signatures
+         * @param hash - binary hash of yac hash
+         * @return hex string of the hash
+         */
+        static std::string serializeHash(const std::string &hash) {
+          return bytestringToHexstring(hash);
+        }
+
+        /**
+         * @param hex - hex string of the hash from the message
+         * @return binary hash, none if the string is not a hex string
+         */
+        static boost::optional<std::string> deserializeHash(
+            const std::string &hex) {
+          if (hex.empty()) {
+            return std::string{};
+          }
+          return hexstringToBytestring(hex);
+        }
+
+        static std::shared_ptr<shared_model::interface::Signature>
+        deserializeSignature(const shared_model::crypto::PublicKey &pubkey,
+                             const shared_model::crypto::Signed &signed_data) {
+          std::shared_ptr<shared_model::interface::Signature> signature;
+          shared_model::builder::DefaultSignatureBuilder()
+              .publicKey(pubkey)
+              .signedData(signed_data)
+              .build()
+              .match(
+                  [&signature](
+                      iroha::expected::Value<
+                          std::shared_ptr<shared_model::interface::Signature>>
+                          &sig) { signature = sig.value; },
+                  [](iroha::expected::Error<std::shared_ptr<std::string>>
+                         &reason) {
+                    logger::log("YacPbConverter::deserializeCompactCommit")
+                        ->error("Cannot build signature: {}", *reason.error);
+                  });
+          return signature;
+        }
       };
     }  // namespace yac
   }    // namespace consensus
@@ -22,6 +22,7 @@
 #include <memory>
 #include <mutex>
 #include <rxcpp/rx-observable.hpp>
+#include <unordered_map>
 
 #include "consensus/yac/cluster_order.hpp"  //  for ClusterOrdering
 #include "consensus/yac/messages.hpp"       // because messages passed by value
@@ -84,6 +85,11 @@ namespace iroha {
          */
         void closeRound();
 
+        /**
+         * Set order of current round and index its peers by public key
+         */
+        void setClusterOrder(ClusterOrdering order);
+
         /**
          * Find corresponding peer in the ledger from vote message
          * @param vote message containing peer information
@@ -130,6 +136,10 @@ namespace iroha {
 
         // ------|One round|------
         ClusterOrdering cluster_order_;
+        /// peers of cluster_order_ by binary public key
+        std::unordered_map<std::string,
+                           std::shared_ptr<shared_model::interface::Peer>>
+            peers_by_key_;
 
         // ------|Logger|------
         logger::Logger log_;
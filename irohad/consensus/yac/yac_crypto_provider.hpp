@@ -28,6 +28,10 @@ namespace iroha {
       struct RejectMessage;
       struct VoteMessage;
 
+      /**
+       * Signs and verifies votes. Verification may be called concurrently
+       * from transport threads.
+       */
       class YacCryptoProvider {
        public:
         /**
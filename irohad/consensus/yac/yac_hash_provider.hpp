@@ -43,12 +43,12 @@ namespace iroha {
         YacHash() = default;
 
         /**
-         * Hash computed from proposal
+         * Binary hash computed from proposal, sent and signed as hex string
          */
         std::string proposal_hash;
 
         /**
-         * Hash computed from block;
+         * Binary hash computed from block, sent and signed as hex string
          */
         std::string block_hash;
 
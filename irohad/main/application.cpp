@@ -16,6 +16,7 @@
  */
 
 #include "main/application.hpp"
+#include "ametsuchi/impl/file_ordering_service_persistent_state.hpp"
 #include "ametsuchi/impl/postgres_ordering_service_persistent_state.hpp"
 #include "ametsuchi/impl/wsv_restorer_impl.hpp"
 #include "consensus/yac/impl/supermajority_checker_impl.hpp"
@@ -49,7 +50,17 @@ Irohad::Irohad(const std::string &block_store_dir,
                std::chrono::milliseconds vote_delay,
                std::chrono::milliseconds load_delay,
                const shared_model::crypto::Keypair &keypair,
-               bool is_mst_supported)
+               bool is_mst_supported,
+               size_t max_queue_size,
+               iroha::ordering::AdmissionPolicy admission_policy,
+               size_t creator_queue_quota,
+               std::chrono::milliseconds duplicate_filter_ttl,
+               boost::optional<iroha::ordering::ProposalBounds>
+                   adaptive_proposal_bounds,
+               const std::string &ordering_service_log_path,
+               bool pipelined_consensus,
+               bool skip_empty_blocks,
+               size_t stateful_validation_workers)
     : block_store_dir_(block_store_dir),
       pg_conn_(pg_conn),
       torii_port_(torii_port),
@@ -59,6 +70,15 @@ Irohad::Irohad(const std::string &block_store_dir,
       vote_delay_(vote_delay),
       load_delay_(load_delay),
       is_mst_supported_(is_mst_supported),
+      max_queue_size_(max_queue_size),
+      admission_policy_(admission_policy),
+      creator_queue_quota_(creator_queue_quota),
+      duplicate_filter_ttl_(duplicate_filter_ttl),
+      adaptive_proposal_bounds_(adaptive_proposal_bounds),
+      ordering_service_log_path_(ordering_service_log_path),
+      pipelined_consensus_(pipelined_consensus),
+      skip_empty_blocks_(skip_empty_blocks),
+      stateful_validation_workers_(stateful_validation_workers),
       keypair(keypair) {
   log_ = logger::log("IROHAD");
   log_->info("created");
@@ -77,6 +97,7 @@ void Irohad::init() {
 
   initPeerQuery();
   initCryptoProvider();
+  initTimerWheel();
   initValidators();
   initOrderingGate();
   initSimulator();
@@ -110,11 +131,23 @@ void Irohad::initStorage() {
       },
       [&](expected::Error<std::string> &error) { log_->error(error.error); });
 
-  PostgresOrderingServicePersistentState::create(pg_conn_).match(
-      [&](expected::Value<
-          std::shared_ptr<ametsuchi::PostgresOrderingServicePersistentState>>
-              &_storage) { ordering_service_storage_ = _storage.value; },
-      [&](expected::Error<std::string> &error) { log_->error(error.error); });
+  if (ordering_service_log_path_.empty()) {
+    PostgresOrderingServicePersistentState::create(pg_conn_).match(
+        [&](expected::Value<
+            std::shared_ptr<ametsuchi::PostgresOrderingServicePersistentState>>
+                &_storage) { ordering_service_storage_ = _storage.value; },
+        [&](expected::Error<std::string> &error) { log_->error(error.error); });
+  } else {
+    FileOrderingServicePersistentState::create(ordering_service_log_path_)
+        .match(
+            [&](expected::Value<std::shared_ptr<
+                    ametsuchi::FileOrderingServicePersistentState>> &_storage) {
+              ordering_service_storage_ = _storage.value;
+            },
+            [&](expected::Error<std::string> &error) {
+              log_->error(error.error);
+            });
+  }
 
   log_->info("[Init] => storage", logger::logBool(storage));
 }
@@ -150,11 +183,23 @@ void Irohad::initCryptoProvider() {
   log_->info("[Init] => crypto provider");
 }
 
+/**
+ * Initializing timer service
+ */
+void Irohad::initTimerWheel() {
+  timer_wheel_ = std::make_shared<iroha::timer::TimerWheel>(
+      std::chrono::milliseconds(10));
+  timer_wheel_->start();
+
+  log_->info("[Init] => timer wheel");
+}
+
 /**
  * Initializing validators
  */
 void Irohad::initValidators() {
-  stateful_validator = std::make_shared<StatefulValidatorImpl>();
+  stateful_validator =
+      std::make_shared<StatefulValidatorImpl>(stateful_validation_workers_);
   chain_validator = std::make_shared<ChainValidatorImpl>(
       std::make_shared<consensus::yac::SupermajorityCheckerImpl>());
 
@@ -169,7 +214,16 @@ void Irohad::initOrderingGate() {
                                                  max_proposal_size_,
                                                  proposal_delay_,
                                                  ordering_service_storage_,
-                                                 storage->getBlockQuery());
+                                                 storage->getBlockQuery(),
+                                                 storage->on_commit(),
+                                                 timer_wheel_,
+                                                 max_queue_size_,
+                                                 admission_policy_,
+                                                 creator_queue_quota_,
+                                                 duplicate_filter_ttl_,
+                                                 adaptive_proposal_bounds_,
+                                                 pipelined_consensus_,
+                                                 skip_empty_blocks_);
   log_->info("[Init] => init ordering gate - [{}]",
              logger::logBool(ordering_gate));
 }
@@ -182,7 +236,8 @@ void Irohad::initSimulator() {
                                           stateful_validator,
                                           storage,
                                           storage->getBlockQuery(),
-                                          crypto_signer_);
+                                          crypto_signer_,
+                                          skip_empty_blocks_);
 
   log_->info("[Init] => init simulator");
 }
@@ -206,7 +261,8 @@ void Irohad::initConsensusGate() {
                                               block_loader,
                                               keypair,
                                               vote_delay_,
-                                              load_delay_);
+                                              load_delay_,
+                                              timer_wheel_);
 
   log_->info("[Init] => consensus gate");
 }
@@ -250,7 +306,8 @@ void Irohad::initMstProcessor() {
     auto mst_propagation = std::make_shared<GossipPropagationStrategy>(
         std::make_shared<ametsuchi::PeerQueryWsv>(storage->getWsvQuery()),
         std::chrono::seconds(5) /*emitting period*/,
-        2 /*amount per once*/);
+        2 /*amount per once*/,
+        timer_wheel_);
     auto mst_time = std::make_shared<MstTimeProviderImpl>();
     mst_processor = std::make_shared<FairMstProcessor>(
         mst_transport, mst_storage, mst_propagation, mst_time);
@@ -38,6 +38,7 @@
 #include "simulator/impl/simulator.hpp"
 #include "synchronizer/impl/synchronizer_impl.hpp"
 #include "synchronizer/synchronizer.hpp"
+#include "timer/timer_wheel.hpp"
 #include "torii/command_service.hpp"
 #include "torii/processor/query_processor_impl.hpp"
 #include "torii/processor/transaction_processor_impl.hpp"
@@ -70,6 +71,25 @@ class Irohad {
    * peer
    * @param keypair - public and private keys for crypto signer
    * @param is_mst_supported - enable or disable mst processing support
+   * @param max_queue_size - maximum number of transactions in ordering
+   * service queue, 0 for unbounded queue
+   * @param admission_policy - handling of transactions when ordering service
+   * queue is full
+   * @param creator_queue_quota - maximum number of queued transactions of
+   * one creator, used with creator quota admission policy
+   * @param duplicate_filter_ttl - time pending transactions are kept in
+   * duplicate filter of ordering service, zero disables the filter
+   * @param adaptive_proposal_bounds - bounds of proposal size and delay for
+   * adaptive mode of ordering service, none for fixed max_proposal_size and
+   * proposal_delay
+   * @param ordering_service_log_path - path to local log of ordering service
+   * state, empty for keeping proposal height in PostgreSQL
+   * @param pipelined_consensus - whether the next proposal is validated on top
+   * of the voted block before its commit
+   * @param skip_empty_blocks - whether proposals without valid transactions
+   * finish their round without consensus and storage of an empty block
+   * @param stateful_validation_workers - maximal number of threads which
+   * validate independent transactions of a proposal
    */
   Irohad(const std::string &block_store_dir,
          const std::string &pg_conn,
@@ -80,7 +100,19 @@ class Irohad {
          std::chrono::milliseconds vote_delay,
          std::chrono::milliseconds load_delay,
          const shared_model::crypto::Keypair &keypair,
-         bool is_mst_supported);
+         bool is_mst_supported,
+         size_t max_queue_size = 0,
+         iroha::ordering::AdmissionPolicy admission_policy =
+             iroha::ordering::AdmissionPolicy::kRejectNew,
+         size_t creator_queue_quota = 0,
+         std::chrono::milliseconds duplicate_filter_ttl =
+             std::chrono::minutes(10),
+         boost::optional<iroha::ordering::ProposalBounds>
+             adaptive_proposal_bounds = boost::none,
+         const std::string &ordering_service_log_path = "",
+         bool pipelined_consensus = false,
+         bool skip_empty_blocks = false,
+         size_t stateful_validation_workers = 1);
 
   /**
    * Initialization of whole objects in system
@@ -119,6 +151,8 @@ class Irohad {
 
   virtual void initCryptoProvider();
 
+  virtual void initTimerWheel();
+
   virtual void initValidators();
 
   virtual void initOrderingGate();
@@ -154,12 +188,24 @@ class Irohad {
   std::chrono::milliseconds vote_delay_;
   std::chrono::milliseconds load_delay_;
   bool is_mst_supported_;
+  size_t max_queue_size_;
+  iroha::ordering::AdmissionPolicy admission_policy_;
+  size_t creator_queue_quota_;
+  std::chrono::milliseconds duplicate_filter_ttl_;
+  boost::optional<iroha::ordering::ProposalBounds> adaptive_proposal_bounds_;
+  std::string ordering_service_log_path_;
+  bool pipelined_consensus_;
+  bool skip_empty_blocks_;
+  size_t stateful_validation_workers_;
 
   // ------------------------| internal dependencies |-------------------------
 
   // crypto provider
   std::shared_ptr<shared_model::crypto::CryptoModelSigner<>> crypto_signer_;
 
+  // timer service shared by consensus, ordering and MST
+  std::shared_ptr<iroha::timer::TimerWheel> timer_wheel_;
+
   // validators
   std::shared_ptr<iroha::validation::StatefulValidator> stateful_validator;
   std::shared_ptr<iroha::validation::ChainValidator> chain_validator;
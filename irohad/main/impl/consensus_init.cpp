@@ -45,34 +45,11 @@ namespace iroha {
         return crypto;
       }
 
-      auto YacInit::createTimer(std::chrono::milliseconds delay_milliseconds) {
-        return std::make_shared<TimerImpl>([delay_milliseconds] {
-          // static factory with a single thread
-          //
-          // observe_on_new_thread -- coordination which creates new thread with
-          // observe_on strategy -- all subsequent operations will be performed
-          // on this thread.
-          //
-          // scheduler owns a timeline that is exposed by the now() method.
-          // scheduler is also a factory for workers in that timeline.
-          //
-          // coordination is a factory for coordinators and has a scheduler.
-          //
-          // coordinator has a worker, and is a factory for coordinated
-          // observables, subscribers and schedulable functions.
-          //
-          // A new thread scheduler is created
-          // by calling .create_coordinator().get_scheduler()
-          //
-          // static allows to reuse the same thread in subsequent calls to this
-          // lambda
-          static rxcpp::observe_on_one_worker coordination(
-              rxcpp::observe_on_new_thread()
-                  .create_coordinator()
-                  .get_scheduler());
-          return rxcpp::observable<>::timer(
-              std::chrono::milliseconds(delay_milliseconds), coordination);
-        });
+      auto YacInit::createTimer(
+          std::shared_ptr<timer::TimerWheel> timer_wheel,
+          std::chrono::milliseconds delay_milliseconds) {
+        return std::make_shared<TimerImpl>(std::move(timer_wheel),
+                                           delay_milliseconds);
       }
 
       auto YacInit::createHashProvider() {
@@ -82,11 +59,13 @@ namespace iroha {
       std::shared_ptr<consensus::yac::Yac> YacInit::createYac(
           ClusterOrdering initial_order,
           const shared_model::crypto::Keypair &keypair,
+          std::shared_ptr<timer::TimerWheel> timer_wheel,
           std::chrono::milliseconds delay_milliseconds) {
         return Yac::create(YacVoteStorage(),
                            createNetwork(),
                            createCryptoProvider(keypair),
-                           createTimer(delay_milliseconds),
+                           createTimer(std::move(timer_wheel),
+                                       delay_milliseconds),
                            initial_order);
       }
 
@@ -96,11 +75,13 @@ namespace iroha {
           std::shared_ptr<network::BlockLoader> block_loader,
           const shared_model::crypto::Keypair &keypair,
           std::chrono::milliseconds vote_delay_milliseconds,
-          std::chrono::milliseconds load_delay_milliseconds) {
+          std::chrono::milliseconds load_delay_milliseconds,
+          std::shared_ptr<timer::TimerWheel> timer_wheel) {
         auto peer_orderer = createPeerOrderer(wsv);
 
         auto yac = createYac(peer_orderer->getInitialOrdering().value(),
                              keypair,
+                             std::move(timer_wheel),
                              vote_delay_milliseconds);
         consensus_network->subscribe(yac);
 
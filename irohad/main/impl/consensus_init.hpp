@@ -33,6 +33,7 @@
 #include "cryptography/keypair.hpp"
 #include "network/block_loader.hpp"
 #include "simulator/block_creator.hpp"
+#include "timer/timer_wheel.hpp"
 
 namespace iroha {
   namespace consensus {
@@ -48,13 +49,15 @@ namespace iroha {
 
         auto createCryptoProvider(const shared_model::crypto::Keypair &keypair);
 
-        auto createTimer(std::chrono::milliseconds delay_milliseconds);
+        auto createTimer(std::shared_ptr<timer::TimerWheel> timer_wheel,
+                         std::chrono::milliseconds delay_milliseconds);
 
         auto createHashProvider();
 
         std::shared_ptr<consensus::yac::Yac> createYac(
             ClusterOrdering initial_order,
             const shared_model::crypto::Keypair &keypair,
+            std::shared_ptr<timer::TimerWheel> timer_wheel,
             std::chrono::milliseconds delay_milliseconds);
 
        public:
@@ -64,7 +67,8 @@ namespace iroha {
             std::shared_ptr<network::BlockLoader> block_loader,
             const shared_model::crypto::Keypair &keypair,
             std::chrono::milliseconds vote_delay_milliseconds,
-            std::chrono::milliseconds load_delay_milliseconds);
+            std::chrono::milliseconds load_delay_milliseconds,
+            std::shared_ptr<timer::TimerWheel> timer_wheel);
 
         std::shared_ptr<NetworkImpl> consensus_network;
       };
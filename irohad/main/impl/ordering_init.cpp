@@ -8,19 +8,29 @@
 #include "interfaces/common_objects/peer.hpp"
 #include "interfaces/common_objects/types.hpp"
 #include "interfaces/iroha_internal/block.hpp"
+#include "timer/timer_observable.hpp"
 
 namespace iroha {
   namespace network {
     auto OrderingInit::createGate(
         std::shared_ptr<OrderingGateTransport> transport,
-        std::shared_ptr<ametsuchi::BlockQuery> block_query) {
+        std::shared_ptr<ametsuchi::BlockQuery> block_query,
+        bool pipelined,
+        bool skip_empty_rounds,
+        std::shared_ptr<ametsuchi::OrderingServicePersistentState>
+            persistent_state) {
       return block_query->getTopBlock().match(
-          [this, &transport](
+          [this, &transport, pipelined, skip_empty_rounds, &persistent_state](
               expected::Value<std::shared_ptr<shared_model::interface::Block>>
                   &block) -> std::shared_ptr<OrderingGate> {
             const auto &height = block.value->height();
             auto gate =
-                std::make_shared<ordering::OrderingGateImpl>(transport, height);
+                std::make_shared<ordering::OrderingGateImpl>(transport,
+                                                             height,
+                                                             true,
+                                                             pipelined,
+                                                             skip_empty_rounds,
+                                                             persistent_state);
             log_->info("Creating Ordering Gate with initial height {}", height);
             transport->subscribe(gate);
             return gate;
@@ -37,16 +47,26 @@ namespace iroha {
         std::shared_ptr<ametsuchi::PeerQuery> wsv,
         size_t max_size,
         std::chrono::milliseconds delay_milliseconds,
+        std::shared_ptr<timer::TimerWheel> timer_wheel,
         std::shared_ptr<network::OrderingServiceTransport> transport,
         std::shared_ptr<ametsuchi::OrderingServicePersistentState>
-            persistent_state) {
+            persistent_state,
+        size_t max_queue_size,
+        ordering::AdmissionPolicy admission_policy,
+        size_t creator_queue_quota,
+        std::shared_ptr<ordering::DuplicateFilter> duplicate_filter,
+        std::shared_ptr<ordering::ProposalController> proposal_controller) {
       return std::make_shared<ordering::OrderingServiceImpl>(
           wsv,
           max_size,
-          rxcpp::observable<>::interval(delay_milliseconds,
-                                        rxcpp::observe_on_new_thread()),
+          timer::interval(std::move(timer_wheel), delay_milliseconds),
           transport,
-          persistent_state);
+          persistent_state,
+          max_queue_size,
+          admission_policy,
+          creator_queue_quota,
+          duplicate_filter,
+          proposal_controller);
     }
 
     std::shared_ptr<OrderingGate> OrderingInit::initOrderingGate(
@@ -55,7 +75,17 @@ namespace iroha {
         std::chrono::milliseconds delay_milliseconds,
         std::shared_ptr<ametsuchi::OrderingServicePersistentState>
             persistent_state,
-        std::shared_ptr<ametsuchi::BlockQuery> block_query) {
+        std::shared_ptr<ametsuchi::BlockQuery> block_query,
+        rxcpp::observable<std::shared_ptr<shared_model::interface::Block>>
+            committed_blocks,
+        std::shared_ptr<timer::TimerWheel> timer_wheel,
+        size_t max_queue_size,
+        ordering::AdmissionPolicy admission_policy,
+        size_t creator_queue_quota,
+        std::chrono::milliseconds duplicate_filter_ttl,
+        boost::optional<ordering::ProposalBounds> adaptive_bounds,
+        bool pipelined,
+        bool skip_empty_rounds) {
       auto ledger_peers = wsv->getLedgerPeers();
       if (not ledger_peers or ledger_peers.value().empty()) {
         log_->error(
@@ -69,13 +99,42 @@ namespace iroha {
 
       ordering_service_transport =
           std::make_shared<ordering::OrderingServiceTransportGrpc>();
+      std::shared_ptr<ordering::DuplicateFilter> duplicate_filter;
+      if (duplicate_filter_ttl != std::chrono::milliseconds::zero()) {
+        duplicate_filter = std::make_shared<ordering::DuplicateFilter>(
+            block_query, committed_blocks, duplicate_filter_ttl);
+      }
+      std::shared_ptr<ordering::ProposalController> proposal_controller;
+      if (adaptive_bounds) {
+        log_->info(
+            "Adaptive proposals of {}-{} transactions every {}-{} ms",
+            adaptive_bounds->min_size,
+            adaptive_bounds->max_size,
+            adaptive_bounds->min_delay.count(),
+            adaptive_bounds->max_delay.count());
+        proposal_controller = std::make_shared<ordering::ProposalController>(
+            *adaptive_bounds, committed_blocks);
+        // timer becomes a tick for the controller
+        delay_milliseconds = adaptive_bounds->min_delay;
+      }
       ordering_service = createService(wsv,
                                        max_size,
                                        delay_milliseconds,
+                                       std::move(timer_wheel),
                                        ordering_service_transport,
-                                       persistent_state);
+                                       persistent_state,
+                                       max_queue_size,
+                                       admission_policy,
+                                       creator_queue_quota,
+                                       duplicate_filter,
+                                       proposal_controller);
       ordering_service_transport->subscribe(ordering_service);
-      ordering_gate = createGate(ordering_gate_transport, block_query);
+      ordering_gate =
+          createGate(ordering_gate_transport,
+                     block_query,
+                     pipelined,
+                     skip_empty_rounds,
+                     persistent_state);
       return ordering_gate;
     }
   }  // namespace network
@@ -25,6 +25,7 @@
 #include "ordering/impl/ordering_gate_transport_grpc.hpp"
 #include "ordering/impl/ordering_service_impl.hpp"
 #include "ordering/impl/ordering_service_transport_grpc.hpp"
+#include "timer/timer_wheel.hpp"
 
 namespace iroha {
 
@@ -45,24 +46,46 @@ namespace iroha {
        * @param transport - object which will be notified
        * about incoming proposals and send transactions
        * @param block_query - block store to get last block height
+       * @param pipelined - whether the next proposal is passed for
+       * speculative validation before commit
+       * @param skip_empty_rounds - whether rounds may finish without a block
+       * @param persistent_state - storage of the round of ordering gate
        */
-      auto createGate(std::shared_ptr<OrderingGateTransport> transport,
-                      std::shared_ptr<ametsuchi::BlockQuery> block_query);
+      auto createGate(
+          std::shared_ptr<OrderingGateTransport> transport,
+          std::shared_ptr<ametsuchi::BlockQuery> block_query,
+          bool pipelined,
+          bool skip_empty_rounds,
+          std::shared_ptr<ametsuchi::OrderingServicePersistentState>
+              persistent_state);
 
       /**
        * Init ordering service
        * @param peers - endpoints of peers for connection
        * @param max_size - limitation of proposal size
        * @param delay_milliseconds - delay before emitting proposal
-       * @param loop - handler of async events
+       * @param timer_wheel - timer service which ticks proposal timer
+       * @param max_queue_size - limitation of transaction queue size
+       * @param admission_policy - handling of transactions when queue is full
+       * @param creator_queue_quota - limitation of queued transactions of one
+       * creator
+       * @param duplicate_filter - filter of already known transactions
+       * @param proposal_controller - controller of proposal size and delay
+       * in adaptive mode, nullptr for fixed ones
        */
       auto createService(
           std::shared_ptr<ametsuchi::PeerQuery> wsv,
           size_t max_size,
           std::chrono::milliseconds delay_milliseconds,
+          std::shared_ptr<timer::TimerWheel> timer_wheel,
           std::shared_ptr<network::OrderingServiceTransport> transport,
           std::shared_ptr<ametsuchi::OrderingServicePersistentState>
-              persistent_state);
+              persistent_state,
+          size_t max_queue_size,
+          ordering::AdmissionPolicy admission_policy,
+          size_t creator_queue_quota,
+          std::shared_ptr<ordering::DuplicateFilter> duplicate_filter,
+          std::shared_ptr<ordering::ProposalController> proposal_controller);
 
      public:
       /**
@@ -72,6 +95,20 @@ namespace iroha {
        * @param max_size - limitation of proposal size
        * @param delay_milliseconds - delay before emitting proposal
        * @param block_query - block store to get last block height
+       * @param committed_blocks - observable of committed blocks
+       * @param timer_wheel - timer service which ticks proposal timer
+       * @param max_queue_size - limitation of transaction queue size
+       * @param admission_policy - handling of transactions when queue is full
+       * @param creator_queue_quota - limitation of queued transactions of one
+       * creator
+       * @param duplicate_filter_ttl - time pending transactions are kept in
+       * duplicate filter, zero disables the filter
+       * @param adaptive_bounds - bounds of proposal size and delay for
+       * adaptive mode, none for fixed max_size and delay_milliseconds
+       * @param pipelined - whether the next proposal is passed for
+       * speculative validation before commit of the current round
+       * @param skip_empty_rounds - whether proposals without valid
+       * transactions finish their round without a block
        * @return efficient implementation of OrderingGate
        */
       std::shared_ptr<iroha::network::OrderingGate> initOrderingGate(
@@ -80,7 +117,20 @@ namespace iroha {
           std::chrono::milliseconds delay_milliseconds,
           std::shared_ptr<ametsuchi::OrderingServicePersistentState>
               persistent_state,
-          std::shared_ptr<ametsuchi::BlockQuery> block_query);
+          std::shared_ptr<ametsuchi::BlockQuery> block_query,
+          rxcpp::observable<std::shared_ptr<shared_model::interface::Block>>
+              committed_blocks,
+          std::shared_ptr<timer::TimerWheel> timer_wheel,
+          size_t max_queue_size = 0,
+          ordering::AdmissionPolicy admission_policy =
+              ordering::AdmissionPolicy::kRejectNew,
+          size_t creator_queue_quota = 0,
+          std::chrono::milliseconds duplicate_filter_ttl =
+              std::chrono::milliseconds::zero(),
+          boost::optional<ordering::ProposalBounds> adaptive_bounds =
+              boost::none,
+          bool pipelined = false,
+          bool skip_empty_rounds = false);
 
       std::shared_ptr<iroha::network::OrderingService> ordering_service;
       std::shared_ptr<iroha::network::OrderingGate> ordering_gate;
@@ -37,6 +37,17 @@ namespace config_members {
   const char *VoteDelay = "vote_delay";
   const char *LoadDelay = "load_delay";
   const char *MstSupport = "mst_enable";
+  const char *MaxQueueSize = "max_queue_size";
+  const char *QueueAdmissionPolicy = "queue_admission_policy";
+  const char *CreatorQueueQuota = "creator_queue_quota";
+  const char *DuplicateFilterTtl = "duplicate_filter_ttl";
+  const char *AdaptiveProposal = "adaptive_proposal";
+  const char *MinProposalSize = "min_proposal_size";
+  const char *MinProposalDelay = "min_proposal_delay";
+  const char *OrderingServiceLog = "ordering_service_log";
+  const char *PipelinedConsensus = "pipelined_consensus";
+  const char *SkipEmptyBlocks = "skip_empty_blocks";
+  const char *StatefulValidationWorkers = "stateful_validation_workers";
 }  // namespace config_members
 
 /**
@@ -102,6 +113,60 @@ inline rapidjson::Document parse_iroha_config(const std::string &conf_path) {
                    ac::no_member_error(mbr::MstSupport));
   ac::assert_fatal(doc[mbr::MstSupport].IsBool(),
                    ac::type_error(mbr::MstSupport, kBoolType));
+
+  // optional members
+  if (doc.HasMember(mbr::MaxQueueSize)) {
+    ac::assert_fatal(doc[mbr::MaxQueueSize].IsUint(),
+                     ac::type_error(mbr::MaxQueueSize, kUintType));
+  }
+
+  if (doc.HasMember(mbr::QueueAdmissionPolicy)) {
+    ac::assert_fatal(doc[mbr::QueueAdmissionPolicy].IsString(),
+                     ac::type_error(mbr::QueueAdmissionPolicy, kStrType));
+  }
+
+  if (doc.HasMember(mbr::CreatorQueueQuota)) {
+    ac::assert_fatal(doc[mbr::CreatorQueueQuota].IsUint(),
+                     ac::type_error(mbr::CreatorQueueQuota, kUintType));
+  }
+
+  if (doc.HasMember(mbr::DuplicateFilterTtl)) {
+    ac::assert_fatal(doc[mbr::DuplicateFilterTtl].IsUint(),
+                     ac::type_error(mbr::DuplicateFilterTtl, kUintType));
+  }
+
+  if (doc.HasMember(mbr::AdaptiveProposal)) {
+    ac::assert_fatal(doc[mbr::AdaptiveProposal].IsBool(),
+                     ac::type_error(mbr::AdaptiveProposal, kBoolType));
+  }
+
+  if (doc.HasMember(mbr::MinProposalSize)) {
+    ac::assert_fatal(doc[mbr::MinProposalSize].IsUint(),
+                     ac::type_error(mbr::MinProposalSize, kUintType));
+  }
+
+  if (doc.HasMember(mbr::MinProposalDelay)) {
+    ac::assert_fatal(doc[mbr::MinProposalDelay].IsUint(),
+                     ac::type_error(mbr::MinProposalDelay, kUintType));
+  }
+
+  if (doc.HasMember(mbr::OrderingServiceLog)) {
+    ac::assert_fatal(doc[mbr::OrderingServiceLog].IsString(),
+                     ac::type_error(mbr::OrderingServiceLog, kStrType));
+  }
+  if (doc.HasMember(mbr::PipelinedConsensus)) {
+    ac::assert_fatal(doc[mbr::PipelinedConsensus].IsBool(),
+                     ac::type_error(mbr::PipelinedConsensus, kBoolType));
+  }
+  if (doc.HasMember(mbr::SkipEmptyBlocks)) {
+    ac::assert_fatal(doc[mbr::SkipEmptyBlocks].IsBool(),
+                     ac::type_error(mbr::SkipEmptyBlocks, kBoolType));
+  }
+  if (doc.HasMember(mbr::StatefulValidationWorkers)) {
+    ac::assert_fatal(
+        doc[mbr::StatefulValidationWorkers].IsUint(),
+        ac::type_error(mbr::StatefulValidationWorkers, kUintType));
+  }
   return doc;
 }
 
@@ -80,6 +80,26 @@ DEFINE_bool(overwrite_ledger, false, "Overwrite ledger data if existing");
 
 std::promise<void> exit_requested;
 
+/**
+ * Parse admission policy of ordering service queue
+ * @param name - policy name from the configuration file
+ * @return corresponding policy, or none if the name is unknown
+ */
+boost::optional<iroha::ordering::AdmissionPolicy> parse_admission_policy(
+    const std::string &name) {
+  using iroha::ordering::AdmissionPolicy;
+  if (name == "reject_new") {
+    return AdmissionPolicy::kRejectNew;
+  }
+  if (name == "drop_oldest") {
+    return AdmissionPolicy::kDropOldest;
+  }
+  if (name == "creator_quota") {
+    return AdmissionPolicy::kCreatorQuota;
+  }
+  return boost::none;
+}
+
 int main(int argc, char *argv[]) {
   auto log = logger::log("MAIN");
   log->info("start");
@@ -112,6 +132,52 @@ int main(int argc, char *argv[]) {
     return EXIT_FAILURE;
   }
 
+  auto max_queue_size = config.HasMember(mbr::MaxQueueSize)
+      ? config[mbr::MaxQueueSize].GetUint()
+      : 0;
+  auto creator_queue_quota = config.HasMember(mbr::CreatorQueueQuota)
+      ? config[mbr::CreatorQueueQuota].GetUint()
+      : 0;
+  auto duplicate_filter_ttl = config.HasMember(mbr::DuplicateFilterTtl)
+      ? std::chrono::milliseconds(config[mbr::DuplicateFilterTtl].GetUint())
+      : std::chrono::milliseconds(std::chrono::minutes(10));
+  auto admission_policy =
+      parse_admission_policy(config.HasMember(mbr::QueueAdmissionPolicy)
+                                 ? config[mbr::QueueAdmissionPolicy].GetString()
+                                 : "reject_new");
+  if (not admission_policy) {
+    log->error("Unknown queue admission policy");
+    return EXIT_FAILURE;
+  }
+  if (*admission_policy == iroha::ordering::AdmissionPolicy::kCreatorQuota
+      and creator_queue_quota == 0) {
+    log->error("Creator queue quota is required for creator_quota policy");
+    return EXIT_FAILURE;
+  }
+
+  boost::optional<iroha::ordering::ProposalBounds> adaptive_proposal_bounds;
+  if (config.HasMember(mbr::AdaptiveProposal)
+      and config[mbr::AdaptiveProposal].GetBool()) {
+    adaptive_proposal_bounds = iroha::ordering::ProposalBounds{
+        config.HasMember(mbr::MinProposalSize)
+            ? config[mbr::MinProposalSize].GetUint()
+            : 1,
+        config[mbr::MaxProposalSize].GetUint(),
+        std::chrono::milliseconds(config.HasMember(mbr::MinProposalDelay)
+                                      ? config[mbr::MinProposalDelay].GetUint()
+                                      : 10),
+        std::chrono::milliseconds(config[mbr::ProposalDelay].GetUint())};
+    if (adaptive_proposal_bounds->min_size == 0
+        or adaptive_proposal_bounds->min_size
+            > adaptive_proposal_bounds->max_size
+        or adaptive_proposal_bounds->min_delay.count() == 0
+        or adaptive_proposal_bounds->min_delay
+            > adaptive_proposal_bounds->max_delay) {
+      log->error("Invalid bounds of adaptive proposal size or delay");
+      return EXIT_FAILURE;
+    }
+  }
+
   // Configuring iroha daemon
   Irohad irohad(config[mbr::BlockStorePath].GetString(),
                 config[mbr::PgOpt].GetString(),
@@ -122,7 +188,22 @@ int main(int argc, char *argv[]) {
                 std::chrono::milliseconds(config[mbr::VoteDelay].GetUint()),
                 std::chrono::milliseconds(config[mbr::LoadDelay].GetUint()),
                 *keypair,
-                config[mbr::MstSupport].GetBool());
+                config[mbr::MstSupport].GetBool(),
+                max_queue_size,
+                *admission_policy,
+                creator_queue_quota,
+                duplicate_filter_ttl,
+                adaptive_proposal_bounds,
+                config.HasMember(mbr::OrderingServiceLog)
+                    ? config[mbr::OrderingServiceLog].GetString()
+                    : "",
+                config.HasMember(mbr::PipelinedConsensus)
+                    and config[mbr::PipelinedConsensus].GetBool(),
+                config.HasMember(mbr::SkipEmptyBlocks)
+                    and config[mbr::SkipEmptyBlocks].GetBool(),
+                config.HasMember(mbr::StatefulValidationWorkers)
+                    ? config[mbr::StatefulValidationWorkers].GetUint()
+                    : 1);
 
   // Check if iroha daemon storage was successfully initialized
   if (not irohad.storage) {
@@ -24,6 +24,7 @@
 #include <chrono>
 #include <mutex>
 #include "ametsuchi/peer_query.hpp"
+#include "timer/timer_wheel.hpp"
 
 namespace iroha {
 
@@ -42,10 +43,17 @@ namespace iroha {
      * @param query is a provider of peer list
      * @param period of emitting data in ms
      * @param amount of peers emitted per once
+     * @param timer_wheel is a timer service which emits data
+     * @param emit_worker is a worker which collects and emits data off the
+     * thread of timer_wheel
      */
-    GossipPropagationStrategy(PeerProvider query,
-                              std::chrono::milliseconds period,
-                              uint32_t amount);
+    GossipPropagationStrategy(
+        PeerProvider query,
+        std::chrono::milliseconds period,
+        uint32_t amount,
+        std::shared_ptr<timer::TimerWheel> timer_wheel,
+        rxcpp::observe_on_one_worker emit_worker =
+            rxcpp::observe_on_new_thread());
 
     ~GossipPropagationStrategy();
 
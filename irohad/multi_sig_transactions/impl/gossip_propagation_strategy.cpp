@@ -23,20 +23,26 @@
 #include <boost/assert.hpp>
 #include <boost/range/irange.hpp>
 #include "common/types.hpp"
+#include "timer/timer_observable.hpp"
 
 namespace iroha {
 
   using PropagationData = PropagationStrategy::PropagationData;
   using OptPeer = GossipPropagationStrategy::OptPeer;
   using PeerProvider = GossipPropagationStrategy::PeerProvider;
-  using std::chrono::steady_clock;
 
   GossipPropagationStrategy::GossipPropagationStrategy(
-      PeerProvider query, std::chrono::milliseconds period, uint32_t amount)
+      PeerProvider query,
+      std::chrono::milliseconds period,
+      uint32_t amount,
+      std::shared_ptr<timer::TimerWheel> timer_wheel,
+      rxcpp::observe_on_one_worker emit_worker)
       : query(query),
         non_visited({}),
-        emitent(rxcpp::observable<>::interval(steady_clock::now(), period)
-                    .map([this, amount](int) {
+        emitent(timer::interval(std::move(timer_wheel), period)
+                    // peer queries do not delay other timers of the wheel
+                    .observe_on(emit_worker)
+                    .map([this, amount](long) {
                       PropagationData vec;
                       auto range = boost::irange(0u, amount);
                       // push until find empty element
@@ -51,7 +57,7 @@ namespace iroha {
                     })) {}
 
   rxcpp::observable<PropagationData> GossipPropagationStrategy::emitter() {
-    return emitent.subscribe_on(rxcpp::observe_on_new_thread());
+    return emitent;
   }
 
   GossipPropagationStrategy::~GossipPropagationStrategy() {
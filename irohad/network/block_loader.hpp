@@ -19,6 +19,7 @@
 #define IROHA_BLOCK_LOADER_HPP
 
 #include <memory>
+#include <vector>
 #include <rxcpp/rx-observable.hpp>
 
 #include "cryptography/public_key.hpp"
@@ -40,6 +41,20 @@ namespace iroha {
       virtual rxcpp::observable<std::shared_ptr<shared_model::interface::Block>>
       retrieveBlocks(const shared_model::crypto::PublicKey &peer_pubkey) = 0;
 
+      /**
+       * Retrieve blocks following current top up to given height. The range
+       * is split between given peers, ranges failed by one peer are
+       * requested from the others
+       * @param peer_pubkeys - peers for requesting blocks
+       * @param target_height - height of the last requested block
+       * @return blocks in order of height, which stop before the first range
+       * none of the peers provided
+       */
+      virtual rxcpp::observable<std::shared_ptr<shared_model::interface::Block>>
+      retrieveChain(
+          const std::vector<shared_model::crypto::PublicKey> &peer_pubkeys,
+          shared_model::interface::types::HeightType target_height) = 0;
+
       /**
        * Retrieve block by its block_hash from given peer
        * @param peer_pubkey - peer for requesting blocks
@@ -52,6 +67,22 @@ namespace iroha {
           const shared_model::crypto::PublicKey &peer_pubkey,
           const shared_model::interface::types::HashType &block_hash) = 0;
 
+      /**
+       * Retrieve block by its hash from any of given peers. Up to
+       * parallel_requests peers are requested at the same time, and the next
+       * peer is requested when one of them fails. Requests still in flight
+       * are cancelled once the block is loaded
+       * @param peer_pubkeys - peers for requesting the block, in order
+       * @param block_hash - requested block hash
+       * @param parallel_requests - number of simultaneous requests
+       * @return block loaded first, nullopt if no peer provided it
+       */
+      virtual boost::optional<std::shared_ptr<shared_model::interface::Block>>
+      retrieveBlock(
+          const std::vector<shared_model::crypto::PublicKey> &peer_pubkeys,
+          const shared_model::interface::types::HashType &block_hash,
+          size_t parallel_requests) = 0;
+
       virtual ~BlockLoader() = default;
     };
   }  // namespace network
@@ -20,6 +20,7 @@
 
 #include <google/protobuf/empty.pb.h>
 #include <grpc++/grpc++.h>
+#include <functional>
 #include <thread>
 
 namespace iroha {
@@ -47,6 +48,9 @@ namespace iroha {
           if (not call->status.ok()) {
             log_->warn("RPC failed: {}", call->status.error_message());
           }
+          if (call->on_finish) {
+            call->on_finish(call->status);
+          }
           delete call;
         }
       }
@@ -74,6 +78,9 @@ namespace iroha {
 
         std::unique_ptr<grpc::ClientAsyncResponseReader<Response>>
             response_reader;
+
+        /// optional handler of call status, invoked on completion
+        std::function<void(const grpc::Status &)> on_finish;
       };
     };
   }  // namespace network
@@ -17,7 +17,15 @@
 
 #include "network/impl/block_loader_impl.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <thread>
+
 #include <grpc++/create_channel.h>
+#include <tbb/pipeline.h>
 
 #include "backend/protobuf/block.hpp"
 #include "builders/protobuf/transport_builder.hpp"
@@ -33,22 +41,37 @@ BlockLoaderImpl::BlockLoaderImpl(
     std::shared_ptr<PeerQuery> peer_query,
     std::shared_ptr<BlockQuery> block_query,
     std::shared_ptr<shared_model::validation::DefaultBlockValidator>
-        stateless_validator)
+        stateless_validator,
+    std::chrono::milliseconds request_timeout,
+    uint32_t range_size)
     : peer_query_(std::move(peer_query)),
       block_query_(std::move(block_query)),
-      stateless_validator_(stateless_validator) {
+      stateless_validator_(stateless_validator),
+      request_timeout_(request_timeout),
+      range_size_(std::max(range_size, 1u)) {
   log_ = logger::log("BlockLoaderImpl");
 }
 
+constexpr std::chrono::milliseconds BlockLoaderImpl::kDefaultRequestTimeout;
+constexpr uint32_t BlockLoaderImpl::kDefaultRangeSize;
+
 const char *kPeerNotFound = "Cannot find peer";
 const char *kTopBlockRetrieveFail = "Failed to retrieve top block";
 const char *kPeerRetrieveFail = "Failed to retrieve peers";
 const char *kPeerFindFail = "Failed to find requested peer";
 
+namespace {
+  /// blocks which are read or validated at once by a single download,
+  /// reading is paused when all of them are in use
+  const size_t kMaxBlocksInFlight =
+      std::max(2 * std::thread::hardware_concurrency(), 2u);
+}  // namespace
+
 rxcpp::observable<std::shared_ptr<Block>> BlockLoaderImpl::retrieveBlocks(
     const PublicKey &peer_pubkey) {
   return rxcpp::observable<>::create<std::shared_ptr<Block>>(
       [this, peer_pubkey](auto subscriber) {
+        std::unique_lock<std::mutex> lock(mutex_);
         std::shared_ptr<Block> top_block;
         block_query_->getTopBlock().match(
             [&top_block](
@@ -62,8 +85,9 @@ rxcpp::observable<std::shared_ptr<Block>> BlockLoaderImpl::retrieveBlocks(
           return;
         }
 
-        auto peer = this->findPeer(peer_pubkey);
-        if (not peer) {
+        auto stub = this->findPeerStub(peer_pubkey);
+        lock.unlock();
+        if (not stub) {
           log_->error(kPeerNotFound);
           subscriber.on_completed();
           return;
@@ -71,55 +95,295 @@ rxcpp::observable<std::shared_ptr<Block>> BlockLoaderImpl::retrieveBlocks(
 
         proto::BlocksRequest request;
         grpc::ClientContext context;
-        protocol::Block block;
 
         // request next block to our top
         request.set_height(top_block->height() + 1);
 
-        auto reader =
-            this->getPeerStub(**peer).retrieveBlocks(&context, request);
-        while (reader->Read(&block)) {
-          shared_model::proto::TransportBuilder<
-              shared_model::proto::Block,
-              shared_model::validation::DefaultSignableBlockValidator>()
-              .build(block)
-              .match(
-                  // success case
-                  [&subscriber](
-                      const iroha::expected::Value<shared_model::proto::Block>
-                          &result) {
-                    subscriber.on_next(
-                        std::move(std::make_shared<shared_model::proto::Block>(
-                            result.value)));
-                  },
-                  // fail case
-                  [this,
-                   &context](const iroha::expected::Error<std::string> &error) {
-                    log_->error(error.error);
-                    context.TryCancel();
+        auto reader = stub->retrieveBlocks(&context, request);
+        this->readValidBlocks(context, *reader, [&subscriber](auto block) {
+          subscriber.on_next(std::move(block));
+          return subscriber.is_subscribed();
+        });
+        reader->Finish();
+        subscriber.on_completed();
+      });
+}
+
+rxcpp::observable<std::shared_ptr<Block>> BlockLoaderImpl::retrieveChain(
+    const std::vector<PublicKey> &peer_pubkeys,
+    types::HeightType target_height) {
+  return rxcpp::observable<>::create<std::shared_ptr<Block>>(
+      [this, peer_pubkeys, target_height](auto subscriber) {
+        boost::optional<types::HeightType> top_height;
+        std::vector<proto::Loader::Stub *> stubs;
+        {
+          std::lock_guard<std::mutex> lock(mutex_);
+          block_query_->getTopBlock().match(
+              [&top_height](expected::Value<std::shared_ptr<Block>> block) {
+                top_height = block.value->height();
+              },
+              [this](expected::Error<std::string> error) {
+                log_->error(kTopBlockRetrieveFail + std::string{": "}
+                            + error.error);
+              });
+          for (const auto &pubkey : peer_pubkeys) {
+            if (auto stub = this->findPeerStub(pubkey)) {
+              stubs.push_back(stub);
+            }
+          }
+        }
+        if (not top_height or stubs.empty()) {
+          subscriber.on_completed();
+          return;
+        }
+
+        /// missing blocks requested from a single peer at once
+        struct Range {
+          types::HeightType height;
+          uint32_t count;
+          /// whether the peer with the same index failed to provide it
+          std::vector<bool> failed;
+        };
+
+        std::deque<Range> pending;
+        std::vector<types::HeightType> order;
+        for (auto height = *top_height + 1; height <= target_height;
+             height += range_size_) {
+          auto count = static_cast<uint32_t>(std::min<types::HeightType>(
+              range_size_, target_height - height + 1));
+          pending.push_back(
+              Range{height, count, std::vector<bool>(stubs.size(), false)});
+          order.push_back(height);
+        }
+        if (pending.empty()) {
+          // storage already reached the target height
+          subscriber.on_completed();
+          return;
+        }
+
+        // state shared by workers, each of them requests from a single peer
+        std::mutex mutex;
+        std::condition_variable cv;
+        std::map<types::HeightType, BlockRange> done;
+        size_t in_flight = 0;
+        size_t active = std::min(stubs.size(), pending.size());
+        bool stopped = false;
+        // downloaded blocks are bounded by the window ahead of emission
+        types::HeightType next = order.front();
+        const auto window = 2 * stubs.size() * range_size_;
+
+        auto worker = [&](size_t peer) {
+          std::unique_lock<std::mutex> lock(mutex);
+          while (not stopped) {
+            auto range = std::find_if(
+                pending.begin(), pending.end(), [&](const auto &range) {
+                  return not range.failed[peer]
+                      and range.height < next + window;
+                });
+            if (range == pending.end()) {
+              auto retriable = std::any_of(
+                  pending.begin(), pending.end(), [peer](const auto &range) {
+                    return not range.failed[peer];
                   });
+              // ranges in flight may fail and be retried by this peer
+              if (not retriable and in_flight == 0) {
+                break;
+              }
+              cv.wait(lock);
+              continue;
+            }
+            auto current = std::move(*range);
+            pending.erase(range);
+            ++in_flight;
+            lock.unlock();
+            auto blocks = this->retrieveRange(
+                *stubs[peer], current.height, current.count);
+            lock.lock();
+            --in_flight;
+            if (blocks) {
+              done.emplace(current.height, std::move(*blocks));
+            } else {
+              current.failed[peer] = true;
+              if (std::count(
+                      current.failed.begin(), current.failed.end(), true)
+                  == static_cast<long>(stubs.size())) {
+                // chain can not be continued after the range
+                stopped = true;
+              } else {
+                // failed range goes first, so it does not delay emission
+                pending.push_front(std::move(current));
+              }
+            }
+            cv.notify_all();
+          }
+          --active;
+          cv.notify_all();
+        };
+
+        std::vector<std::thread> workers;
+        for (size_t peer = 0, size = active; peer < size; ++peer) {
+          workers.emplace_back(worker, peer);
+        }
+
+        for (auto height : order) {
+          BlockRange blocks;
+          {
+            std::unique_lock<std::mutex> lock(mutex);
+            next = height;
+            cv.notify_all();
+            cv.wait(lock, [&] { return done.count(height) or active == 0; });
+            auto it = done.find(height);
+            if (it == done.end()) {
+              log_->error("None of {} peers provided blocks from height {}",
+                          stubs.size(),
+                          height);
+              break;
+            }
+            blocks = std::move(it->second);
+            done.erase(it);
+          }
+          for (auto &block : blocks) {
+            subscriber.on_next(std::move(block));
+          }
+          if (not subscriber.is_subscribed()) {
+            break;
+          }
+        }
+
+        {
+          std::lock_guard<std::mutex> lock(mutex);
+          stopped = true;
+        }
+        cv.notify_all();
+        for (auto &thread : workers) {
+          thread.join();
         }
-        reader->Finish();
         subscriber.on_completed();
       });
 }
 
+boost::optional<BlockLoaderImpl::BlockRange> BlockLoaderImpl::retrieveRange(
+    proto::Loader::Stub &stub, types::HeightType height, uint32_t count) {
+  proto::BlocksRequest request;
+  grpc::ClientContext context;
+  // range of a peer which does not respond is requested from other peers
+  context.set_deadline(std::chrono::system_clock::now() + request_timeout_);
+
+  request.set_height(height);
+  request.set_count(count);
+
+  BlockRange blocks;
+  auto reader = stub.retrieveBlocks(&context, request);
+  readValidBlocks(context, *reader, [&](std::shared_ptr<Block> block) {
+    if (block->height() != height + blocks.size()) {
+      log_->error("Unexpected block height {}, expected {}",
+                  block->height(),
+                  height + blocks.size());
+      return false;
+    }
+    blocks.push_back(std::move(block));
+    return blocks.size() < count;
+  });
+  // peers which ignore count send blocks up to their top
+  context.TryCancel();
+  reader->Finish();
+
+  if (blocks.size() != count) {
+    log_->warn("Received {} of {} blocks from height {}",
+               blocks.size(),
+               count,
+               height);
+    return boost::none;
+  }
+  return blocks;
+}
+
+bool BlockLoaderImpl::readValidBlocks(
+    grpc::ClientContext &context,
+    grpc::ClientReaderInterface<protocol::Block> &reader,
+    std::function<bool(std::shared_ptr<Block>)> consumer) {
+  using ReadBlock = std::shared_ptr<protocol::Block>;
+  using ValidBlock = std::shared_ptr<Block>;
+  std::atomic<bool> stopped{false};
+  bool valid = true;
+  auto stop = [&] {
+    stopped = true;
+    context.TryCancel();
+  };
+
+  tbb::parallel_pipeline(
+      kMaxBlocksInFlight,
+      // blocks are read from the stream one by one
+      tbb::make_filter<void, ReadBlock>(
+          tbb::filter::serial_in_order,
+          [&](tbb::flow_control &control) {
+            auto block = std::make_shared<protocol::Block>();
+            if (stopped or not reader.Read(block.get())) {
+              control.stop();
+              return ReadBlock{};
+            }
+            return block;
+          })
+          // stateless validation with signatures runs on all cores
+          & tbb::make_filter<ReadBlock, ValidBlock>(
+                tbb::filter::parallel,
+                [this, &stopped](ReadBlock block) {
+                  if (stopped) {
+                    return ValidBlock{};
+                  }
+                  return shared_model::proto::TransportBuilder<
+                             shared_model::proto::Block,
+                             shared_model::validation::
+                                 DefaultSignableBlockValidator>()
+                      .build(std::move(*block))
+                      .match(
+                          [](iroha::expected::Value<shared_model::proto::Block>
+                                 &result) -> ValidBlock {
+                            return std::make_shared<shared_model::proto::Block>(
+                                std::move(result.value));
+                          },
+                          [this](const iroha::expected::Error<std::string>
+                                     &error) -> ValidBlock {
+                            log_->error(error.error);
+                            return nullptr;
+                          });
+                })
+          // valid blocks are handed over in order of the stream
+          & tbb::make_filter<ValidBlock, void>(
+                tbb::filter::serial_in_order, [&](ValidBlock block) {
+                  if (stopped) {
+                    return;
+                  }
+                  if (not block) {
+                    valid = false;
+                    stop();
+                  } else if (not consumer(std::move(block))) {
+                    stop();
+                  }
+                }));
+  return valid;
+}
+
 boost::optional<std::shared_ptr<Block>> BlockLoaderImpl::retrieveBlock(
     const PublicKey &peer_pubkey, const types::HashType &block_hash) {
-  auto peer = findPeer(peer_pubkey);
-  if (not peer) {
+  auto stub = [&] {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return findPeerStub(peer_pubkey);
+  }();
+  if (not stub) {
     log_->error(kPeerNotFound);
     return boost::none;
   }
 
   proto::BlockRequest request;
   grpc::ClientContext context;
+  context.set_deadline(std::chrono::system_clock::now() + request_timeout_);
   protocol::Block block;
 
   // request block with specified hash
   request.set_hash(toBinaryString(block_hash));
 
-  auto status = getPeerStub(**peer).retrieveBlock(&context, request, &block);
+  auto status = stub->retrieveBlock(&context, request, &block);
   if (not status.ok()) {
     log_->warn(status.error_message());
     return boost::none;
@@ -136,6 +400,93 @@ boost::optional<std::shared_ptr<Block>> BlockLoaderImpl::retrieveBlock(
   return boost::optional<std::shared_ptr<Block>>(std::move(result));
 }
 
+boost::optional<std::shared_ptr<Block>> BlockLoaderImpl::retrieveBlock(
+    const std::vector<PublicKey> &peer_pubkeys,
+    const types::HashType &block_hash,
+    size_t parallel_requests) {
+  std::vector<std::pair<const PublicKey *, proto::Loader::Stub *>> peers;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto &pubkey : peer_pubkeys) {
+      if (auto stub = findPeerStub(pubkey)) {
+        peers.emplace_back(&pubkey, stub);
+      }
+    }
+  }
+
+  /// request of the block from a single peer
+  struct Call {
+    size_t peer;
+    grpc::ClientContext context;
+    protocol::Block block;
+    grpc::Status status;
+    std::unique_ptr<grpc::ClientAsyncResponseReader<protocol::Block>> reader;
+  };
+
+  proto::BlockRequest request;
+  request.set_hash(toBinaryString(block_hash));
+  // calls are destroyed before the queue, after all of them are finished
+  grpc::CompletionQueue queue;
+  std::vector<std::unique_ptr<Call>> calls;
+  size_t in_flight = 0;
+  auto request_next = [&] {
+    auto call = std::make_unique<Call>();
+    call->peer = calls.size();
+    call->context.set_deadline(std::chrono::system_clock::now()
+                               + request_timeout_);
+    call->reader = peers[call->peer].second->AsyncretrieveBlock(
+        &call->context, request, &queue);
+    call->reader->Finish(&call->block, &call->status, call.get());
+    calls.push_back(std::move(call));
+    ++in_flight;
+  };
+  while (calls.size() < peers.size() and in_flight < parallel_requests) {
+    request_next();
+  }
+
+  std::shared_ptr<Block> result;
+  void *tag;
+  bool ok;
+  // every started call is awaited, cancelled ones finish immediately
+  while (in_flight > 0 and queue.Next(&tag, &ok)) {
+    --in_flight;
+    auto call = static_cast<Call *>(tag);
+    if (result) {
+      continue;
+    }
+    if (not call->status.ok()) {
+      log_->warn(call->status.error_message());
+    } else {
+      auto block =
+          std::make_shared<shared_model::proto::Block>(std::move(call->block));
+      auto answer = stateless_validator_->validate(*block);
+      if (not answer.hasErrors()) {
+        log_->info("Block {} loaded from peer {}",
+                   block_hash.hex(),
+                   peers[call->peer].first->hex());
+        result = std::move(block);
+        for (auto &other : calls) {
+          other->context.TryCancel();
+        }
+        continue;
+      }
+      log_->error(answer.reason());
+    }
+    if (calls.size() < peers.size()) {
+      request_next();
+    }
+  }
+  queue.Shutdown();
+  while (queue.Next(&tag, &ok)) {
+  }
+
+  if (not result) {
+    log_->warn("No peer provided block {}", block_hash.hex());
+    return boost::none;
+  }
+  return boost::optional<std::shared_ptr<Block>>(std::move(result));
+}
+
 boost::optional<std::shared_ptr<shared_model::interface::Peer>>
 BlockLoaderImpl::findPeer(const shared_model::crypto::PublicKey &pubkey) {
   auto peers = peer_query_->getLedgerPeers();
@@ -168,3 +519,12 @@ proto::Loader::Stub &BlockLoaderImpl::getPeerStub(
   }
   return *it->second;
 }
+
+proto::Loader::Stub *BlockLoaderImpl::findPeerStub(
+    const shared_model::crypto::PublicKey &pubkey) {
+  auto peer = findPeer(pubkey);
+  if (not peer) {
+    return nullptr;
+  }
+  return &getPeerStub(**peer);
+}
@@ -20,7 +20,11 @@
 
 #include "network/block_loader.hpp"
 
+#include <chrono>
+#include <functional>
+#include <mutex>
 #include <unordered_map>
+#include <vector>
 
 #include "ametsuchi/block_query.hpp"
 #include "ametsuchi/peer_query.hpp"
@@ -37,18 +41,70 @@ namespace iroha {
           std::shared_ptr<ametsuchi::BlockQuery> block_query,
           std::shared_ptr<shared_model::validation::DefaultBlockValidator> =
               std::make_shared<
-                  shared_model::validation::DefaultBlockValidator>());
+                  shared_model::validation::DefaultBlockValidator>(),
+          std::chrono::milliseconds request_timeout = kDefaultRequestTimeout,
+          uint32_t range_size = kDefaultRangeSize);
+
+      /// default deadline of a request of a block or a range of blocks
+      static constexpr std::chrono::milliseconds kDefaultRequestTimeout{5000};
+
+      /// default number of blocks requested from a peer at once
+      static constexpr uint32_t kDefaultRangeSize = 500;
 
       rxcpp::observable<std::shared_ptr<shared_model::interface::Block>>
       retrieveBlocks(
           const shared_model::crypto::PublicKey &peer_pubkey) override;
 
+      rxcpp::observable<std::shared_ptr<shared_model::interface::Block>>
+      retrieveChain(
+          const std::vector<shared_model::crypto::PublicKey> &peer_pubkeys,
+          shared_model::interface::types::HeightType target_height) override;
+
       boost::optional<std::shared_ptr<shared_model::interface::Block>>
       retrieveBlock(
           const shared_model::crypto::PublicKey &peer_pubkey,
           const shared_model::interface::types::HashType &block_hash) override;
 
+      boost::optional<std::shared_ptr<shared_model::interface::Block>>
+      retrieveBlock(
+          const std::vector<shared_model::crypto::PublicKey> &peer_pubkeys,
+          const shared_model::interface::types::HashType &block_hash,
+          size_t parallel_requests) override;
+
      private:
+      using BlockRange =
+          std::vector<std::shared_ptr<shared_model::interface::Block>>;
+
+      /**
+       * Request range of blocks from peer and validate them statelessly
+       * @param stub - RPC stub of the peer
+       * @param height - height of the first block
+       * @param count - number of blocks
+       * @return all blocks of the range in order, nullopt if the peer failed
+       * to provide any of them before the request timeout
+       */
+      boost::optional<BlockRange> retrieveRange(
+          proto::Loader::Stub &stub,
+          shared_model::interface::types::HeightType height,
+          uint32_t count);
+
+      /**
+       * Read blocks from the stream and validate them statelessly. Reading,
+       * validation of several blocks in parallel and hand-over of valid
+       * blocks in order of the stream overlap, and the number of blocks in
+       * memory is bounded, so reading waits for slow validation.
+       * @param context - context of the stream, cancelled when reading stops
+       * @param reader - stream of blocks
+       * @param consumer - receives valid blocks in order, returns false to
+       * stop reading
+       * @return false if reading is stopped by an invalid block
+       */
+      bool readValidBlocks(
+          grpc::ClientContext &context,
+          grpc::ClientReaderInterface<protocol::Block> &reader,
+          std::function<bool(std::shared_ptr<shared_model::interface::Block>)>
+              consumer);
+
       /**
        * Retrieve peers from database, and find the requested peer by pubkey
        * @param pubkey - public key of requested peer
@@ -65,6 +121,14 @@ namespace iroha {
       proto::Loader::Stub &getPeerStub(
           const shared_model::interface::Peer &peer);
 
+      /**
+       * Find the requested peer and get RPC stub for it
+       * @param pubkey - public key of requested peer
+       * @return RPC stub, if peer was found, otherwise nullptr
+       */
+      proto::Loader::Stub *findPeerStub(
+          const shared_model::crypto::PublicKey &pubkey);
+
       std::unordered_map<shared_model::interface::types::AddressType,
                          std::unique_ptr<proto::Loader::Stub>>
           peer_connections_;
@@ -72,6 +136,12 @@ namespace iroha {
       std::shared_ptr<ametsuchi::BlockQuery> block_query_;
       std::shared_ptr<shared_model::validation::DefaultBlockValidator>
           stateless_validator_;
+      std::chrono::milliseconds request_timeout_;
+      uint32_t range_size_;
+
+      /// guards queries and peer connections, blocks can be requested from
+      /// several threads at once
+      std::mutex mutex_;
 
       logger::Logger log_;
     };
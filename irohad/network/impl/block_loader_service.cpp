@@ -16,6 +16,9 @@
  */
 
 #include "network/impl/block_loader_service.hpp"
+
+#include <limits>
+
 #include "backend/protobuf/block.hpp"
 
 using namespace iroha;
@@ -31,13 +34,12 @@ grpc::Status BlockLoaderService::retrieveBlocks(
     ::grpc::ServerContext *context,
     const proto::BlocksRequest *request,
     ::grpc::ServerWriter<::iroha::protocol::Block> *writer) {
-  storage_->getBlocksFrom(request->height())
-      .map([](auto block) {
-        return std::dynamic_pointer_cast<shared_model::proto::Block>(block)
-            ->getTransport();
-      })
+  // stored blocks are sent as is, without building and validating models
+  auto count = request->count() == 0 ? std::numeric_limits<uint32_t>::max()
+                                     : request->count();
+  storage_->getBlockTransports(request->height(), count)
       .as_blocking()
-      .subscribe([writer](auto block) { writer->Write(block); });
+      .subscribe([writer](const auto &block) { writer->Write(*block); });
   return grpc::Status::OK;
 }
 
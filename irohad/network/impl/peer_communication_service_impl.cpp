@@ -38,6 +38,11 @@ namespace iroha {
       return ordering_gate_->on_proposal();
     }
 
+    rxcpp::observable<shared_model::interface::types::HashType>
+    PeerCommunicationServiceImpl::on_rejected_transaction() const {
+      return ordering_gate_->on_rejected_transaction();
+    }
+
     rxcpp::observable<Commit> PeerCommunicationServiceImpl::on_commit() const {
       return synchronizer_->on_commit_chain();
     }
@@ -39,6 +39,9 @@ namespace iroha {
       rxcpp::observable<std::shared_ptr<shared_model::interface::Proposal>>
       on_proposal() const override;
 
+      rxcpp::observable<shared_model::interface::types::HashType>
+      on_rejected_transaction() const override;
+
       rxcpp::observable<Commit> on_commit() const override;
 
      private:
@@ -19,6 +19,7 @@
 #define IROHA_ORDERING_SERVICE_HPP
 
 #include <rxcpp/rx-observable.hpp>
+#include "interfaces/common_objects/types.hpp"
 #include "network/peer_communication_service.hpp"
 
 namespace shared_model {
@@ -52,6 +53,35 @@ namespace iroha {
           std::shared_ptr<shared_model::interface::Proposal>>
       on_proposal() = 0;
 
+      /**
+       * Return observable of transactions which were rejected by ordering
+       * service without being queued, e.g. because it is overloaded
+       * @return observable with hashes of rejected transactions
+       */
+      virtual rxcpp::observable<shared_model::interface::types::HashType>
+      on_rejected_transaction() = 0;
+
+      /**
+       * Return observable of proposals passed before the block preceding
+       * them is committed, so they can be validated speculatively on top of
+       * the block this peer voted for. Each of them is passed to on_proposal
+       * again after the commit. Proposals are emitted on the thread which
+       * handles proposals and commits in the gate, so validation should be
+       * moved to another thread by the subscriber.
+       * @return observable with notifications
+       */
+      virtual rxcpp::observable<
+          std::shared_ptr<shared_model::interface::Proposal>>
+      on_speculative_proposal() = 0;
+
+      /**
+       * Finish the round of proposal which produced no block, so the
+       * proposal of the next round is passed to pipeline without a commit
+       * @param proposal_height - height of the proposal
+       */
+      virtual void skipRound(
+          shared_model::interface::types::HeightType proposal_height) = 0;
+
       /**
        * Set peer communication service for commit notification
        * @param pcs - const reference for PeerCommunicationService
@@ -19,6 +19,8 @@
 
 #include <memory>
 
+#include "interfaces/common_objects/types.hpp"
+
 namespace shared_model {
   namespace interface {
     class Transaction;
@@ -42,6 +44,13 @@ namespace iroha {
       virtual void onProposal(
           std::shared_ptr<shared_model::interface::Proposal>) = 0;
 
+      /**
+       * Callback on transaction rejected by ordering service
+       * @param tx_hash - hash of rejected transaction
+       */
+      virtual void onTransactionRejected(
+          const shared_model::interface::types::HashType &tx_hash) = 0;
+
       virtual ~OrderingGateNotification() = default;
     };
 
@@ -33,8 +33,10 @@ namespace iroha {
       /**
        * Callback on receiving transaction
        * @param transaction - transaction object itself
+       * @return false if transaction was not accepted, e.g. because the
+       * service is overloaded
        */
-      virtual void onTransaction(
+      virtual bool onTransaction(
           std::shared_ptr<shared_model::interface::Transaction>
               transaction) = 0;
 
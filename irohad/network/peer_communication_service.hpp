@@ -20,6 +20,8 @@
 
 #include <rxcpp/rx.hpp>
 
+#include "interfaces/common_objects/types.hpp"
+
 namespace shared_model {
   namespace interface {
     class Block;
@@ -57,6 +59,14 @@ namespace iroha {
           std::shared_ptr<shared_model::interface::Proposal>>
       on_proposal() const = 0;
 
+      /**
+       * Event is triggered when ordering service refuses to accept a
+       * transaction, e.g. because its queue is full
+       * @return observable with hashes of rejected transactions
+       */
+      virtual rxcpp::observable<shared_model::interface::types::HashType>
+      on_rejected_transaction() const = 0;
+
       /**
        * Event is triggered when commit block arrives.
        * @return observable with sequence of committed blocks.
@@ -0,0 +1,144 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_CREATOR_FAIR_QUEUE_HPP
+#define IROHA_CREATOR_FAIR_QUEUE_HPP
+
+#include <tbb/concurrent_hash_map.h>
+#include <tbb/concurrent_queue.h>
+#include <atomic>
+#include <memory>
+#include <string>
+
+namespace iroha {
+  namespace ordering {
+
+    /**
+     * Concurrent queue which keeps a separate FIFO queue for every creator
+     * and pops elements in round-robin order over creators, so a creator
+     * with many queued elements does not delay the others.
+     * Any number of threads may push and pop concurrently.
+     * @tparam T - type of queued elements
+     */
+    template <typename T>
+    class CreatorFairQueue {
+     public:
+      /**
+       * Enqueue element to the queue of its creator
+       * @param creator - id of element creator
+       * @param value - element to be queued
+       */
+      void push(const std::string &creator, T value) {
+        // the accessor keeps the creator queue from being erased while the
+        // element is added
+        typename QueuesMap::const_accessor accessor;
+        if (not queues_.find(accessor, creator)) {
+          queues_.insert(accessor,
+                         {creator, std::make_shared<CreatorQueue>(creator)});
+        }
+        const auto &queue = accessor->second;
+        queue->elements.push(std::move(value));
+        ++size_;
+        // the first element of the creator makes the creator ready
+        if (queue->size.fetch_add(1) == 0) {
+          ready_.push(queue);
+        }
+      }
+
+      /**
+       * Dequeue the oldest element of the next ready creator
+       * @param value - popped element
+       * @return true if an element was popped, false if the queue is empty
+       */
+      bool try_pop(T &value) {
+        std::shared_ptr<CreatorQueue> queue;
+        if (not ready_.try_pop(queue)) {
+          return false;
+        }
+        // only the holder of ready token pops from the creator queue,
+        // and the token exists only while the creator queue is not empty
+        queue->elements.try_pop(value);
+        --size_;
+        if (queue->size.fetch_sub(1) > 1) {
+          ready_.push(std::move(queue));
+        } else {
+          erase(queue);
+        }
+        return true;
+      }
+
+      /**
+       * @return true if there are no queued elements
+       */
+      bool empty() const {
+        return size_.load() == 0;
+      }
+
+      /**
+       * @return number of queued elements, may be inaccurate during
+       * concurrent modifications
+       */
+      size_t size() const {
+        return size_.load();
+      }
+
+      /**
+       * @return number of creators with queued elements
+       */
+      size_t readyCreators() const {
+        return ready_.unsafe_size();
+      }
+
+      /**
+       * @return number of creators with a queue, creators without queued
+       * elements are not tracked
+       */
+      size_t trackedCreators() const {
+        return queues_.size();
+      }
+
+     private:
+      /**
+       * Queue of elements of one creator
+       */
+      struct CreatorQueue {
+        explicit CreatorQueue(std::string creator)
+            : creator(std::move(creator)) {}
+
+        const std::string creator;
+        tbb::concurrent_queue<T> elements;
+        std::atomic<size_t> size{0};
+      };
+
+      /**
+       * Forget drained queue, so the map does not grow with every creator
+       * ever seen. Pushes hold the accessor, so an element which is being
+       * added to the queue prevents erasure
+       */
+      void erase(const std::shared_ptr<CreatorQueue> &queue) {
+        typename QueuesMap::accessor accessor;
+        if (queues_.find(accessor, queue->creator)
+            and accessor->second == queue and queue->size.load() == 0) {
+          queues_.erase(accessor);
+        }
+      }
+
+      using QueuesMap =
+          tbb::concurrent_hash_map<std::string, std::shared_ptr<CreatorQueue>>;
+
+      /// queues of creators with queued elements
+      QueuesMap queues_;
+
+      /// creators with queued elements in round-robin order
+      tbb::concurrent_queue<std::shared_ptr<CreatorQueue>> ready_;
+
+      /// total number of queued elements
+      std::atomic<size_t> size_{0};
+    };
+
+  }  // namespace ordering
+}  // namespace iroha
+
+#endif  // IROHA_CREATOR_FAIR_QUEUE_HPP
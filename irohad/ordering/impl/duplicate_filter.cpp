@@ -0,0 +1,169 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ordering/impl/duplicate_filter.hpp"
+
+#include <algorithm>
+
+#include "ametsuchi/block_query.hpp"
+#include "interfaces/iroha_internal/block.hpp"
+
+namespace iroha {
+  namespace ordering {
+
+    DuplicateFilter::DuplicateFilter(
+        std::shared_ptr<ametsuchi::BlockQuery> block_query,
+        rxcpp::observable<std::shared_ptr<shared_model::interface::Block>>
+            committed_blocks,
+        std::chrono::milliseconds pending_ttl,
+        size_t min_capacity,
+        size_t max_capacity,
+        size_t seed_window)
+        : block_query_(std::move(block_query)),
+          pending_ttl_(pending_ttl),
+          min_capacity_(min_capacity),
+          max_capacity_(std::max(min_capacity, max_capacity)),
+          seed_window_(seed_window),
+          committed_(min_capacity),
+          log_(logger::log("DuplicateFilter")) {
+      // subscribe before seeding, so blocks committed meanwhile are not
+      // missed, they are added to the seeded filter
+      subscription_ = committed_blocks.subscribe(
+          [this](const auto &block) { this->onCommit(*block); });
+      rebuild();
+    }
+
+    bool DuplicateFilter::insert(const shared_model::crypto::Hash &hash) {
+      auto now = Clock::now();
+      auto remember = [&] {
+        if (not pending_.emplace(hash, now).second) {
+          return false;
+        }
+        expiration_.emplace_back(now, hash);
+        return true;
+      };
+
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        expirePending(now);
+        if (pending_.count(hash) != 0) {
+          return false;
+        }
+        if (not committed_.mayContain(hash.blob())) {
+          return remember();
+        }
+      }
+
+      // Bloom filter may give false positive answer, so it is confirmed
+      if (isCommitted(hash)) {
+        return false;
+      }
+      std::lock_guard<std::mutex> lock(mutex_);
+      return remember();
+    }
+
+    bool DuplicateFilter::committed(const shared_model::crypto::Hash &hash) {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (not committed_.mayContain(hash.blob())) {
+          return false;
+        }
+      }
+      return isCommitted(hash);
+    }
+
+    void DuplicateFilter::erase(const shared_model::crypto::Hash &hash) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      pending_.erase(hash);
+    }
+
+    void DuplicateFilter::onCommit(
+        const shared_model::interface::Block &block) {
+      bool full;
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (const auto &tx : block.transactions()) {
+          const auto &hash = tx.hash();
+          committed_.add(hash.blob());
+          pending_.erase(hash);
+          if (rebuilding_) {
+            committed_during_rebuild_.push_back(hash);
+          }
+        }
+        full = committed_.size() > committed_.capacity();
+      }
+      if (full) {
+        rebuild();
+      }
+    }
+
+    size_t DuplicateFilter::pendingSize() const {
+      std::lock_guard<std::mutex> lock(mutex_);
+      return pending_.size();
+    }
+
+    DuplicateFilter::~DuplicateFilter() {
+      subscription_.unsubscribe();
+    }
+
+    void DuplicateFilter::expirePending(Clock::time_point now) {
+      while (not expiration_.empty()
+             and expiration_.front().first + pending_ttl_ <= now) {
+        const auto &expired = expiration_.front();
+        auto it = pending_.find(expired.second);
+        // transaction could be erased and inserted again later
+        if (it != pending_.end() and it->second == expired.first) {
+          pending_.erase(it);
+        }
+        expiration_.pop_front();
+      }
+    }
+
+    void DuplicateFilter::rebuild() {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (rebuilding_) {
+          return;
+        }
+        rebuilding_ = true;
+      }
+
+      std::vector<shared_model::crypto::Hash> hashes;
+      {
+        std::lock_guard<std::mutex> lock(query_mutex_);
+        auto top = block_query_->getTopBlockHeight();
+        auto from = top > seed_window_ ? top - seed_window_ + 1 : 1;
+        hashes = block_query_->getTxHashesFrom(from);
+      }
+      // the newest half of the capacity at most, so the filter is not
+      // refilled on every commit
+      if (hashes.size() > max_capacity_ / 2) {
+        hashes.erase(hashes.begin() + max_capacity_ / 2, hashes.end());
+      }
+      TxHashBloomFilter filter(
+          std::min(max_capacity_, std::max(min_capacity_, hashes.size() * 2)));
+      for (const auto &hash : hashes) {
+        filter.add(hash.blob());
+      }
+
+      std::lock_guard<std::mutex> lock(mutex_);
+      for (const auto &hash : committed_during_rebuild_) {
+        filter.add(hash.blob());
+      }
+      committed_during_rebuild_.clear();
+      committed_ = std::move(filter);
+      rebuilding_ = false;
+      log_->info("Seeded with {} committed transactions, capacity {}",
+                 committed_.size(),
+                 committed_.capacity());
+    }
+
+    bool DuplicateFilter::isCommitted(const shared_model::crypto::Hash &hash) {
+      std::lock_guard<std::mutex> lock(query_mutex_);
+      return block_query_->hasTxWithHash(hash);
+    }
+
+  }  // namespace ordering
+}  // namespace iroha
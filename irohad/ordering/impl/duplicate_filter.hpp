@@ -0,0 +1,166 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_DUPLICATE_FILTER_HPP
+#define IROHA_DUPLICATE_FILTER_HPP
+
+#include <chrono>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <rxcpp/rx.hpp>
+#include <unordered_map>
+
+#include "cryptography/hash.hpp"
+#include "logger/logger.hpp"
+#include "ordering/impl/tx_hash_bloom_filter.hpp"
+
+namespace shared_model {
+  namespace interface {
+    class Block;
+  }  // namespace interface
+}  // namespace shared_model
+
+namespace iroha {
+
+  namespace ametsuchi {
+    class BlockQuery;
+  }  // namespace ametsuchi
+
+  namespace ordering {
+
+    /**
+     * Filter of transactions already known to ordering service by hash.
+     * Pending transactions (queued or proposed, but not committed yet) are
+     * kept in a hash set for a bounded time.
+     * Recently committed transactions are kept in a Bloom filter seeded
+     * from the last blocks of the storage and updated on every commit; its
+     * positive answers are confirmed by the block storage, so unique
+     * transactions are never dropped. Older transactions are left to the
+     * expiration of their creation time.
+     * Multisignature transactions are not remembered as pending: their
+     * signatures are collected by resubmitting them with the same hash, so
+     * they are checked with committed() only.
+     */
+    class DuplicateFilter {
+     public:
+      using Clock = std::chrono::steady_clock;
+
+      /**
+       * @param block_query - storage of committed transactions, used only
+       * by the filter
+       * @param committed_blocks - observable of committed blocks, should not
+       * emit on subscription
+       * @param pending_ttl - time a pending transaction is remembered for
+       * @param min_capacity - minimal expected number of committed
+       * transactions in Bloom filter
+       * @param max_capacity - maximal expected number of committed
+       * transactions in Bloom filter, it is refilled with the newest half
+       * when exceeded
+       * @param seed_window - number of the last blocks the filter is
+       * seeded from
+       */
+      DuplicateFilter(
+          std::shared_ptr<ametsuchi::BlockQuery> block_query,
+          rxcpp::observable<std::shared_ptr<shared_model::interface::Block>>
+              committed_blocks,
+          std::chrono::milliseconds pending_ttl,
+          size_t min_capacity = kMinCapacity,
+          size_t max_capacity = kMaxCapacity,
+          size_t seed_window = kSeedWindow);
+
+      /**
+       * Remember transaction as pending if it is not known yet
+       * @param hash - hash of transaction
+       * @return false if transaction is pending or committed already
+       */
+      bool insert(const shared_model::crypto::Hash &hash);
+
+      /**
+       * Check transaction against committed ones only
+       * @param hash - hash of transaction
+       * @return true if transaction is committed already
+       */
+      bool committed(const shared_model::crypto::Hash &hash);
+
+      /**
+       * Forget pending transaction, so it could be received again
+       * @param hash - hash of transaction which was not accepted
+       */
+      void erase(const shared_model::crypto::Hash &hash);
+
+      /**
+       * Move transactions of committed block from pending to committed
+       * @param block - committed block
+       */
+      void onCommit(const shared_model::interface::Block &block);
+
+      /**
+       * @return number of remembered pending transactions
+       */
+      size_t pendingSize() const;
+
+      ~DuplicateFilter();
+
+      static constexpr size_t kMinCapacity = 1 << 16;
+      static constexpr size_t kMaxCapacity = 1 << 22;
+      static constexpr size_t kSeedWindow = 10000;
+
+     private:
+      /**
+       * Forget pending transactions remembered longer than pending_ttl_
+       * @param now - current time
+       */
+      void expirePending(Clock::time_point now);
+
+      /**
+       * Refill Bloom filter from the last blocks of the storage. The storage
+       * is read without the lock, transactions committed meanwhile are
+       * added to the new filter before it replaces the current one
+       */
+      void rebuild();
+
+      /**
+       * @param hash - hash of transaction
+       * @return true if transaction is committed
+       */
+      bool isCommitted(const shared_model::crypto::Hash &hash);
+
+      std::shared_ptr<ametsuchi::BlockQuery> block_query_;
+      /// block query is not thread-safe
+      std::mutex query_mutex_;
+
+      const std::chrono::milliseconds pending_ttl_;
+      const size_t min_capacity_;
+      const size_t max_capacity_;
+      const size_t seed_window_;
+
+      /// pending transactions with time of insertion
+      std::unordered_map<shared_model::crypto::Hash,
+                         Clock::time_point,
+                         shared_model::crypto::Hash::Hasher>
+          pending_;
+      /// pending transactions in order of insertion
+      std::deque<std::pair<Clock::time_point, shared_model::crypto::Hash>>
+          expiration_;
+
+      TxHashBloomFilter committed_;
+      /// whether Bloom filter is being rebuilt
+      bool rebuilding_ = false;
+      /// transactions committed during the rebuild
+      std::vector<shared_model::crypto::Hash> committed_during_rebuild_;
+
+      /// guards pending transactions and Bloom filter
+      mutable std::mutex mutex_;
+
+      rxcpp::composite_subscription subscription_;
+
+      logger::Logger log_;
+    };
+
+  }  // namespace ordering
+}  // namespace iroha
+
+#endif  // IROHA_DUPLICATE_FILTER_HPP
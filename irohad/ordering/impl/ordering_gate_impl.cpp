@@ -15,6 +15,7 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <tuple>
 #include <utility>
 
@@ -36,11 +37,28 @@ namespace iroha {
     OrderingGateImpl::OrderingGateImpl(
         std::shared_ptr<iroha::network::OrderingGateTransport> transport,
         shared_model::interface::types::HeightType initial_height,
-        bool run_async)
+        bool run_async,
+        bool pipelined,
+        bool skip_empty_rounds,
+        std::shared_ptr<ametsuchi::OrderingServicePersistentState>
+            persistent_state)
         : transport_(std::move(transport)),
           last_block_height_(initial_height),
           log_(logger::log("OrderingGate")),
-          run_async_(run_async) {}
+          run_async_(run_async),
+          pipelined_(pipelined),
+          skip_empty_rounds_(skip_empty_rounds),
+          persistent_state_(std::move(persistent_state)) {
+      if (skip_empty_rounds_ and persistent_state_) {
+        // skipped rounds leave proposal heights ahead of block heights
+        auto passed = persistent_state_->loadPassedProposalHeight();
+        if (passed and *passed > last_block_height_) {
+          log_->info("Restore round of proposal height {}", *passed);
+          last_block_height_ = *passed;
+          last_passed_height_ = *passed;
+        }
+      }
+    }
 
     void OrderingGateImpl::propagateTransaction(
         std::shared_ptr<const shared_model::interface::Transaction>
@@ -56,16 +74,43 @@ namespace iroha {
       return proposals_.get_observable();
     }
 
+    rxcpp::observable<shared_model::interface::types::HashType>
+    OrderingGateImpl::on_rejected_transaction() {
+      return rejected_transactions_.get_observable();
+    }
+
+    rxcpp::observable<std::shared_ptr<shared_model::interface::Proposal>>
+    OrderingGateImpl::on_speculative_proposal() {
+      return speculative_proposals_.get_observable();
+    }
+
+    void OrderingGateImpl::skipRound(
+        shared_model::interface::types::HeightType proposal_height) {
+      log_->info("Skip round of empty proposal, height: {}", proposal_height);
+      std::lock_guard<std::mutex> lock(skipped_mutex_);
+      skipped_rounds_.get_subscriber().on_next(proposal_height);
+    }
+
     void OrderingGateImpl::setPcs(
         const iroha::network::PeerCommunicationService &pcs) {
       log_->info("setPcs");
 
+      auto committed_height = pcs.on_commit().transform(
+          [](const Commit &commit) {
+            // find height of last commited block
+            return commit.as_blocking().last()->height();
+          });
+      // when empty rounds are skipped, block heights lag behind proposal
+      // heights, so a commit finishes the round of the last passed proposal
       auto top_block_height =
-          pcs.on_commit()
-              .transform([](const Commit &commit) {
-                // find height of last commited block
-                return commit.as_blocking().last()->height();
-              })
+          (skip_empty_rounds_
+               ? committed_height
+                     .map([this](auto height) {
+                       return std::max(height, last_passed_height_.load());
+                     })
+                     .merge(skipped_rounds_.get_observable())
+                     .as_dynamic()
+               : committed_height.as_dynamic())
               .start_with(last_block_height_);
 
       auto subscribe = [&](auto merge_strategy) {
@@ -95,6 +140,13 @@ namespace iroha {
       net_proposals_.get_subscriber().on_next(0);
     }
 
+    void OrderingGateImpl::onTransactionRejected(
+        const shared_model::interface::types::HashType &tx_hash) {
+      log_->warn("Transaction {} rejected by ordering service", tx_hash.hex());
+      std::lock_guard<std::mutex> lock(rejected_mutex_);
+      rejected_transactions_.get_subscriber().on_next(tx_hash);
+    }
+
     void OrderingGateImpl::tryNextRound(
         shared_model::interface::types::HeightType last_block_height) {
       log_->debug("TryNextRound");
@@ -107,12 +159,27 @@ namespace iroha {
         }
         // check for new proposal
         if (next_proposal->height() > last_block_height + 1) {
+          // the proposal follows the one in consensus now
+          if (pipelined_ and last_passed_height_ == last_block_height + 1
+              and next_proposal->height() == last_block_height + 2
+              and next_proposal->height() > last_speculative_height_) {
+            log_->info("Pass the proposal to speculative validation height {}",
+                       next_proposal->height());
+            last_speculative_height_ = next_proposal->height();
+            speculative_proposals_.get_subscriber().on_next(next_proposal);
+          }
           log_->debug("Proposal newer than last block, keeping in queue");
           proposal_queue_.push(next_proposal);
           break;
         }
         log_->info("Pass the proposal to pipeline height {}",
                    next_proposal->height());
+        if (skip_empty_rounds_ and persistent_state_
+            and not persistent_state_->savePassedProposalHeight(
+                    next_proposal->height())) {
+          log_->warn("Height of passed proposal cannot be saved");
+        }
+        last_passed_height_ = next_proposal->height();
         proposals_.get_subscriber().on_next(next_proposal);
       }
     }
@@ -20,10 +20,12 @@
 
 #include "network/ordering_gate.hpp"
 
+#include <atomic>
 #include <mutex>
 
 #include <tbb/concurrent_priority_queue.h>
 
+#include "ametsuchi/ordering_service_persistent_state.hpp"
 #include "interfaces/common_objects/types.hpp"
 #include "logger/logger.hpp"
 #include "network/impl/async_grpc_client.hpp"
@@ -62,11 +64,22 @@ namespace iroha {
        * @param initial_height - height of the last block stored on this peer
        * @param run_async - whether proposals should be handled
        * asynchronously (on separate thread). Default is true.
+       * @param pipelined - whether proposal for the next round should be
+       * passed for speculative validation before commit of the current one
+       * @param skip_empty_rounds - whether rounds may finish without a block,
+       * so proposal heights are tracked separately from block heights
+       * @param persistent_state - storage of the height of the last passed
+       * proposal, which restores the round after launch when empty rounds
+       * are skipped
        */
       OrderingGateImpl(
           std::shared_ptr<iroha::network::OrderingGateTransport> transport,
           shared_model::interface::types::HeightType initial_height,
-          bool run_async = true);
+          bool run_async = true,
+          bool pipelined = false,
+          bool skip_empty_rounds = false,
+          std::shared_ptr<ametsuchi::OrderingServicePersistentState>
+              persistent_state = nullptr);
 
       void propagateTransaction(
           std::shared_ptr<const shared_model::interface::Transaction>
@@ -75,11 +88,23 @@ namespace iroha {
       rxcpp::observable<std::shared_ptr<shared_model::interface::Proposal>>
       on_proposal() override;
 
+      rxcpp::observable<shared_model::interface::types::HashType>
+      on_rejected_transaction() override;
+
+      rxcpp::observable<std::shared_ptr<shared_model::interface::Proposal>>
+      on_speculative_proposal() override;
+
+      void skipRound(
+          shared_model::interface::types::HeightType proposal_height) override;
+
       void setPcs(const iroha::network::PeerCommunicationService &pcs) override;
 
       void onProposal(
           std::shared_ptr<shared_model::interface::Proposal> proposal) override;
 
+      void onTransactionRejected(
+          const shared_model::interface::types::HashType &tx_hash) override;
+
       ~OrderingGateImpl() override;
 
      private:
@@ -88,7 +113,8 @@ namespace iroha {
        * @param - last_block_height - what is the last block stored on this
        * peer, or for which commit was received. If block is newer than
        * currently stored proposals, proposals are discarded. If it is older,
-       * newer proposals are propagated in order
+       * newer proposals are propagated in order. When empty rounds are
+       * skipped, it is the height of the last finished round instead
        */
       void tryNextRound(
           shared_model::interface::types::HeightType last_block_height);
@@ -97,8 +123,23 @@ namespace iroha {
           std::shared_ptr<shared_model::interface::Proposal>>
           proposals_;
 
+      rxcpp::subjects::subject<
+          std::shared_ptr<shared_model::interface::Proposal>>
+          speculative_proposals_;
+
       rxcpp::subjects::subject<shared_model::interface::types::HeightType>
           net_proposals_;
+
+      /// heights of proposals of rounds finished without a block
+      rxcpp::subjects::subject<shared_model::interface::types::HeightType>
+          skipped_rounds_;
+      std::mutex skipped_mutex_;
+
+      /// hashes of transactions rejected by ordering service
+      rxcpp::subjects::subject<shared_model::interface::types::HashType>
+          rejected_transactions_;
+      std::mutex rejected_mutex_;
+
       std::shared_ptr<iroha::network::OrderingGateTransport> transport_;
 
       std::mutex proposal_mutex_;
@@ -112,12 +153,23 @@ namespace iroha {
       /// last commited block height
       shared_model::interface::types::HeightType last_block_height_;
 
+      /// height of the last proposal passed to pipeline
+      std::atomic<shared_model::interface::types::HeightType>
+          last_passed_height_{0};
+
+      /// height of the last proposal passed for speculative validation
+      shared_model::interface::types::HeightType last_speculative_height_{0};
+
       /// subscription of pcs::on_commit
       rxcpp::composite_subscription pcs_subscriber_;
 
       logger::Logger log_;
 
       bool run_async_;
+      bool pipelined_;
+      bool skip_empty_rounds_;
+      std::shared_ptr<ametsuchi::OrderingServicePersistentState>
+          persistent_state_;
     };
   }  // namespace ordering
 }  // namespace iroha
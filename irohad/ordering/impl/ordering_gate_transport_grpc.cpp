@@ -69,6 +69,18 @@ void OrderingGateTransportGrpc::propagateTransaction(
   log_->debug("Propagating: '{}'", transaction_transport.DebugString());
   call->response_reader =
       client_->AsynconTransaction(&call->context, transaction_transport, &cq_);
+  call->on_finish = [this, hash = transaction->hash()](
+                        const grpc::Status &status) {
+    if (status.error_code() != grpc::StatusCode::RESOURCE_EXHAUSTED) {
+      return;
+    }
+    log_->warn("Transaction {} rejected by ordering service", hash.hex());
+    if (auto subscriber = subscriber_.lock()) {
+      subscriber->onTransactionRejected(hash);
+    } else {
+      log_->error("(onTransactionRejected) No subscriber");
+    }
+  };
 
   call->response_reader->Finish(&call->reply, &call->status, call);
 }
@@ -6,6 +6,7 @@
 #include "ordering/impl/ordering_service_impl.hpp"
 #include <algorithm>
 #include <iterator>
+#include <thread>
 #include "ametsuchi/ordering_service_persistent_state.hpp"
 #include "ametsuchi/peer_query.hpp"
 #include "backend/protobuf/proposal.hpp"
@@ -22,15 +23,40 @@ namespace iroha {
         std::shared_ptr<network::OrderingServiceTransport> transport,
         std::shared_ptr<ametsuchi::OrderingServicePersistentState>
             persistent_state,
+        size_t max_queue_size,
+        AdmissionPolicy admission_policy,
+        size_t creator_quota,
+        std::shared_ptr<DuplicateFilter> duplicate_filter,
+        std::shared_ptr<ProposalController> proposal_controller,
         bool is_async)
         : wsv_(wsv),
           max_size_(max_size),
+          max_queue_size_(max_queue_size),
+          admission_policy_(admission_policy),
+          creator_quota_(creator_quota),
+          duplicate_filter_(std::move(duplicate_filter)),
+          proposal_controller_(std::move(proposal_controller)),
+          last_proposal_time_(ProposalController::Clock::now()),
           transport_(transport),
           persistent_state_(persistent_state) {
       log_ = logger::log("OrderingServiceImpl");
 
       // restore state of ordering service from persistent storage
       proposal_height_ = persistent_state_->loadProposalHeight().value();
+      for (auto &transaction : persistent_state_->loadTransactions()) {
+        // restored transactions bypass admission policy
+        ++queue_size_;
+        if (admission_policy_ == AdmissionPolicy::kCreatorQuota) {
+          ++creator_counts_[transaction->creatorAccountId()];
+        }
+        if (duplicate_filter_ and transaction->quorum() <= 1) {
+          duplicate_filter_->insert(transaction->hash());
+        }
+        queue_.push(transaction->creatorAccountId(), std::move(transaction));
+      }
+      if (not queue_.empty()) {
+        log_->info("Restored {} queued transactions", queue_.size());
+      }
 
       rxcpp::observable<ProposalEvent> timer =
           proposal_timeout.map([](auto) { return ProposalEvent::kTimerEvent; });
@@ -42,9 +68,15 @@ namespace iroha {
                         auto check_queue = [&] {
                           switch (v) {
                             case ProposalEvent::kTimerEvent:
+                              if (proposal_controller_) {
+                                return proposal_controller_->shouldPropose(
+                                    queue_size_.load(),
+                                    last_proposal_time_,
+                                    ProposalController::Clock::now());
+                              }
                               return not queue_.empty();
                             case ProposalEvent::kTransactionEvent:
-                              return queue_.unsafe_size() >= max_size_;
+                              return queue_size_.load() >= proposalSize();
                             default:
                               BOOST_ASSERT_MSG(false, "Unknown value");
                           }
@@ -64,38 +96,205 @@ namespace iroha {
       }
     }
 
-    void OrderingServiceImpl::onTransaction(
+    bool OrderingServiceImpl::onTransaction(
         std::shared_ptr<shared_model::interface::Transaction> transaction) {
-      queue_.push(transaction);
-      log_->info("Queue size is {}", queue_.unsafe_size());
+      ++received_count_;
+      if (isDuplicate(*transaction)) {
+        ++duplicate_count_;
+        log_->info("Transaction {} is already known, dropping",
+                   transaction->hash().hex());
+        return true;
+      }
+      if (not admitTransaction(*transaction)) {
+        if (duplicate_filter_) {
+          duplicate_filter_->erase(transaction->hash());
+        }
+        ++rejected_count_;
+        log_->warn("Transaction {} rejected, queue size is {}",
+                   transaction->hash().hex(),
+                   queue_size_.load());
+        return false;
+      }
+      if (not persistent_state_->saveTransaction(*transaction)) {
+        log_->warn("Transaction {} cannot be saved, it will be lost on restart",
+                   transaction->hash().hex());
+      }
+      queue_.push(transaction->creatorAccountId(), transaction);
+      log_->info("Queue size is {}", queue_size_.load());
 
       // on_next calls should not be concurrent
       std::lock_guard<std::mutex> lk(mutex_);
       transactions_.get_subscriber().on_next(ProposalEvent::kTransactionEvent);
+      return true;
+    }
+
+    size_t OrderingServiceImpl::queueSize() const {
+      return queue_size_.load();
+    }
+
+    size_t OrderingServiceImpl::rejectedTransactions() const {
+      return rejected_count_.load();
+    }
+
+    size_t OrderingServiceImpl::droppedTransactions() const {
+      return dropped_count_.load();
+    }
+
+    size_t OrderingServiceImpl::duplicateTransactions() const {
+      return duplicate_count_.load();
+    }
+
+    bool OrderingServiceImpl::isDuplicate(
+        const shared_model::interface::Transaction &transaction) {
+      if (not duplicate_filter_) {
+        return false;
+      }
+      // signatures of multisignature transaction are collected by
+      // resubmitting it with the same hash, so it is dropped only when
+      // committed
+      if (transaction.quorum() > 1) {
+        return duplicate_filter_->committed(transaction.hash());
+      }
+      return not duplicate_filter_->insert(transaction.hash());
+    }
+
+    bool OrderingServiceImpl::admitTransaction(
+        const shared_model::interface::Transaction &transaction) {
+      switch (admission_policy_) {
+        case AdmissionPolicy::kRejectNew:
+          return reserveQueueSlot();
+        case AdmissionPolicy::kDropOldest:
+          while (not reserveQueueSlot()) {
+            std::shared_ptr<shared_model::interface::Transaction> oldest;
+            if (queue_.try_pop(oldest)) {
+              releaseSlot(*oldest);
+              if (duplicate_filter_) {
+                duplicate_filter_->erase(oldest->hash());
+              }
+              persistent_state_->removeTransactions({oldest->hash()});
+              ++dropped_count_;
+              log_->warn("Queue is full, dropping transaction {}",
+                         oldest->hash().hex());
+            } else {
+              // places are reserved, but transactions are not pushed yet
+              std::this_thread::yield();
+            }
+          }
+          return true;
+        case AdmissionPolicy::kCreatorQuota: {
+          const auto &creator = transaction.creatorAccountId();
+          if (not reserveCreatorSlot(creator)) {
+            return false;
+          }
+          if (not reserveQueueSlot()) {
+            std::lock_guard<std::mutex> lock(creator_mutex_);
+            if (--creator_counts_[creator] == 0) {
+              creator_counts_.erase(creator);
+            }
+            return false;
+          }
+          return true;
+        }
+        default:
+          BOOST_ASSERT_MSG(false, "Unknown admission policy");
+          return false;
+      }
+    }
+
+    bool OrderingServiceImpl::reserveQueueSlot() {
+      if (max_queue_size_ == 0) {
+        ++queue_size_;
+        return true;
+      }
+      auto size = queue_size_.load();
+      do {
+        if (size >= max_queue_size_) {
+          return false;
+        }
+      } while (not queue_size_.compare_exchange_weak(size, size + 1));
+      return true;
+    }
+
+    bool OrderingServiceImpl::reserveCreatorSlot(const std::string &creator) {
+      std::lock_guard<std::mutex> lock(creator_mutex_);
+      auto &count = creator_counts_[creator];
+      if (count >= creator_quota_) {
+        if (count == 0) {
+          creator_counts_.erase(creator);
+        }
+        return false;
+      }
+      ++count;
+      return true;
+    }
+
+    void OrderingServiceImpl::releaseSlot(
+        const shared_model::interface::Transaction &transaction) {
+      --queue_size_;
+      if (admission_policy_ == AdmissionPolicy::kCreatorQuota) {
+        std::lock_guard<std::mutex> lock(creator_mutex_);
+        auto it = creator_counts_.find(transaction.creatorAccountId());
+        if (it != creator_counts_.end() and --it->second == 0) {
+          creator_counts_.erase(it);
+        }
+      }
+    }
+
+    size_t OrderingServiceImpl::proposalSize() const {
+      return proposal_controller_ ? proposal_controller_->proposalSize()
+                                  : max_size_;
     }
 
     void OrderingServiceImpl::generateProposal() {
       // TODO 05/03/2018 andrei IR-1046 Server-side shared model object
       // factories with move semantics
       iroha::protocol::Proposal proto_proposal;
+      const auto created_time = iroha::time::now();
       proto_proposal.set_height(proposal_height_++);
-      proto_proposal.set_created_time(iroha::time::now());
+      proto_proposal.set_created_time(created_time);
+      last_proposal_time_ = ProposalController::Clock::now();
+      const auto max_size = proposalSize();
       log_->info("Start proposal generation");
+      std::vector<shared_model::crypto::Hash> hashes;
       for (std::shared_ptr<shared_model::interface::Transaction> tx;
-           static_cast<size_t>(proto_proposal.transactions_size()) < max_size_
+           static_cast<size_t>(proto_proposal.transactions_size()) < max_size
            and queue_.try_pop(tx);) {
+        releaseSlot(*tx);
+        hashes.push_back(tx->hash());
         *proto_proposal.add_transactions() =
             std::move(static_cast<shared_model::proto::Transaction *>(tx.get())
                           ->getTransport());
       }
 
+      auto received = received_count_.load();
+      auto duplicates = duplicate_count_.load();
+      log_->info(
+          "Proposal of {} transactions (limit {}), queue size {}, rejected {}, "
+          "dropped {}, duplicates {} ({:.2f}% of received)",
+          proto_proposal.transactions_size(),
+          max_size,
+          queue_size_.load(),
+          rejected_count_.load(),
+          dropped_count_.load(),
+          duplicates,
+          received == 0 ? 0. : 100. * duplicates / received);
+
       auto proposal = std::make_unique<shared_model::proto::Proposal>(
           std::move(proto_proposal));
 
+      // Proposed transactions could be proposed again after restart,
+      // then they are rejected by stateful validation
+      if (not persistent_state_->removeTransactions(hashes)) {
+        log_->warn("Proposed transactions cannot be removed from storage");
+      }
+
       // Save proposal height to the persistent storage.
       // In case of restart it reloads state.
       if (persistent_state_->saveProposalHeight(proposal_height_)) {
         publishProposal(std::move(proposal));
+        if (proposal_controller_) {
+          proposal_controller_->onProposal(created_time);
+        }
       } else {
         // TODO(@l4l) 23/03/18: publish proposal independent of psql status
         // IR-1162
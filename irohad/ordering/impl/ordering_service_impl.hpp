@@ -6,14 +6,18 @@
 #ifndef IROHA_ORDERING_SERVICE_IMPL_HPP
 #define IROHA_ORDERING_SERVICE_IMPL_HPP
 
-#include <tbb/concurrent_queue.h>
+#include <atomic>
 #include <memory>
 #include <mutex>
 #include <rxcpp/rx.hpp>
+#include <unordered_map>
 
 #include "logger/logger.hpp"
 #include "network/ordering_service.hpp"
 #include "ordering.grpc.pb.h"
+#include "ordering/impl/creator_fair_queue.hpp"
+#include "ordering/impl/duplicate_filter.hpp"
+#include "ordering/impl/proposal_controller.hpp"
 
 namespace iroha {
 
@@ -24,11 +28,29 @@ namespace iroha {
 
   namespace ordering {
 
+    /**
+     * Strategy of handling incoming transactions when the queue of ordering
+     * service is full
+     */
+    enum class AdmissionPolicy {
+      /// reject incoming transaction
+      kRejectNew,
+      /// drop the oldest transaction of the creator next in turn in favor of
+      /// incoming one
+      kDropOldest,
+      /// reject incoming transaction also when its creator has exceeded
+      /// the quota of queued transactions
+      kCreatorQuota
+    };
+
     /**
      * OrderingService implementation with gRPC synchronous server
      * Allows receiving transactions concurrently from multiple peers by using
      * concurrent queue
+     * Proposals are filled in round-robin order over transaction creators
      * Sends proposal by given timer interval and proposal size
+     * In adaptive mode timer is used as a tick, and proposal size and delay
+     * are chosen by ProposalController
      */
     class OrderingServiceImpl : public network::OrderingService {
      public:
@@ -40,6 +62,16 @@ namespace iroha {
        * @param proposal_timeout observable timeout for proposal creation
        * @param transport receive transactions and publish proposals
        * @param persistent_state storage for auxiliary information
+       * @param max_queue_size maximum number of queued transactions,
+       * 0 means unbounded queue
+       * @param admission_policy strategy of handling transactions
+       * when the queue is full
+       * @param creator_quota maximum number of queued transactions of one
+       * creator, used only with AdmissionPolicy::kCreatorQuota
+       * @param duplicate_filter filter of already known transactions,
+       * nullptr disables filtering
+       * @param proposal_controller controller of proposal size and delay,
+       * nullptr for fixed max_size and proposal_timeout
        * @param is_async whether proposals are generated in a separate thread
        */
       OrderingServiceImpl(
@@ -49,16 +81,43 @@ namespace iroha {
           std::shared_ptr<network::OrderingServiceTransport> transport,
           std::shared_ptr<ametsuchi::OrderingServicePersistentState>
               persistent_state,
+          size_t max_queue_size = 0,
+          AdmissionPolicy admission_policy = AdmissionPolicy::kRejectNew,
+          size_t creator_quota = 0,
+          std::shared_ptr<DuplicateFilter> duplicate_filter = nullptr,
+          std::shared_ptr<ProposalController> proposal_controller = nullptr,
           bool is_async = true);
 
       /**
        * Process transaction received from network
        * Enqueues transaction and publishes corresponding event
+       * Drops transaction silently if it is already known
        * @param transaction
+       * @return false if the transaction was rejected by admission policy
        */
-      void onTransaction(std::shared_ptr<shared_model::interface::Transaction>
+      bool onTransaction(std::shared_ptr<shared_model::interface::Transaction>
                              transaction) override;
 
+      /**
+       * @return number of transactions waiting in the queue
+       */
+      size_t queueSize() const;
+
+      /**
+       * @return number of transactions rejected since start
+       */
+      size_t rejectedTransactions() const;
+
+      /**
+       * @return number of queued transactions dropped since start
+       */
+      size_t droppedTransactions() const;
+
+      /**
+       * @return number of duplicate transactions dropped since start
+       */
+      size_t duplicateTransactions() const;
+
       ~OrderingServiceImpl() override;
 
      protected:
@@ -81,10 +140,49 @@ namespace iroha {
        */
       void generateProposal() override;
 
+      /**
+       * @return current maximal number of transactions in proposal
+       */
+      size_t proposalSize() const;
+
+      /**
+       * Check transaction with duplicate filter, remembering it as pending
+       * @param transaction - received transaction
+       * @return true if transaction is already known and should be dropped
+       */
+      bool isDuplicate(const shared_model::interface::Transaction &transaction);
+
+      /**
+       * Reserve a place in the queue for the transaction according to
+       * admission policy
+       * @param transaction - transaction to be enqueued
+       * @return true if the place is reserved
+       */
+      bool admitTransaction(
+          const shared_model::interface::Transaction &transaction);
+
+      /**
+       * Try to reserve a place in the queue without exceeding max_queue_size_
+       * @return true if the place is reserved
+       */
+      bool reserveQueueSlot();
+
+      /**
+       * Try to reserve a place in the quota of the creator
+       * @param creator - account id of transaction creator
+       * @return true if the place is reserved
+       */
+      bool reserveCreatorSlot(const std::string &creator);
+
+      /**
+       * Free places reserved by the transaction which left the queue
+       * @param transaction - transaction popped from the queue
+       */
+      void releaseSlot(const shared_model::interface::Transaction &transaction);
+
       std::shared_ptr<ametsuchi::PeerQuery> wsv_;
 
-      tbb::concurrent_queue<
-          std::shared_ptr<shared_model::interface::Transaction>>
+      CreatorFairQueue<std::shared_ptr<shared_model::interface::Transaction>>
           queue_;
 
       /**
@@ -92,6 +190,44 @@ namespace iroha {
        */
       const size_t max_size_;
 
+      /**
+       * max number of txs in queue, 0 if unbounded
+       */
+      const size_t max_queue_size_;
+
+      const AdmissionPolicy admission_policy_;
+
+      /**
+       * max number of txs of one creator in queue
+       */
+      const size_t creator_quota_;
+
+      /// number of txs in queue including places reserved by admission
+      std::atomic<size_t> queue_size_{0};
+
+      /// number of rejected incoming txs
+      std::atomic<size_t> rejected_count_{0};
+
+      /// number of queued txs dropped in favor of newer ones
+      std::atomic<size_t> dropped_count_{0};
+
+      /// number of incoming txs dropped as duplicates
+      std::atomic<size_t> duplicate_count_{0};
+
+      /// number of all incoming txs
+      std::atomic<size_t> received_count_{0};
+
+      std::shared_ptr<DuplicateFilter> duplicate_filter_;
+
+      std::shared_ptr<ProposalController> proposal_controller_;
+
+      /// time of the last proposal generation
+      ProposalController::Clock::time_point last_proposal_time_;
+
+      /// number of queued txs per creator account
+      std::unordered_map<std::string, size_t> creator_counts_;
+      std::mutex creator_mutex_;
+
       std::shared_ptr<network::OrderingServiceTransport> transport_;
 
       /**
@@ -34,10 +34,11 @@ grpc::Status OrderingServiceTransportGrpc::onTransaction(
   log_->info("OrderingServiceTransportGrpc::onTransaction");
   if (subscriber_.expired()) {
     log_->error("No subscriber");
-  } else {
-    subscriber_.lock()->onTransaction(
-        std::make_shared<shared_model::proto::Transaction>(
-            iroha::protocol::Transaction(*request)));
+  } else if (not subscriber_.lock()->onTransaction(
+                 std::make_shared<shared_model::proto::Transaction>(
+                     iroha::protocol::Transaction(*request)))) {
+    return ::grpc::Status(::grpc::StatusCode::RESOURCE_EXHAUSTED,
+                          "Ordering service is overloaded");
   }
 
   return ::grpc::Status::OK;
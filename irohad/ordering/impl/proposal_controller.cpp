@@ -0,0 +1,111 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ordering/impl/proposal_controller.hpp"
+
+#include <algorithm>
+
+#include "interfaces/iroha_internal/block.hpp"
+
+namespace {
+  /// weight of the latest commit latency in the average
+  constexpr double kSmoothing = 0.25;
+  /// number of additive steps from minimal to maximal proposal size
+  constexpr size_t kSizeSteps = 16;
+  /// maximal number of proposals waiting for commit
+  constexpr size_t kMaxPublished = 1024;
+}  // namespace
+
+namespace iroha {
+  namespace ordering {
+
+    ProposalController::ProposalController(
+        ProposalBounds bounds,
+        rxcpp::observable<std::shared_ptr<shared_model::interface::Block>>
+            committed_blocks)
+        : bounds_(bounds),
+          size_(bounds.max_size),
+          latency_(bounds.min_delay.count()),
+          log_(logger::log("ProposalController")) {
+      subscription_ = committed_blocks.subscribe(
+          [this](const auto &block) { this->onCommit(block->createdTime()); });
+    }
+
+    size_t ProposalController::proposalSize() const {
+      std::lock_guard<std::mutex> lock(mutex_);
+      return size_;
+    }
+
+    std::chrono::milliseconds ProposalController::proposalDelay() const {
+      std::lock_guard<std::mutex> lock(mutex_);
+      return currentDelay();
+    }
+
+    bool ProposalController::shouldPropose(size_t queue_size,
+                                           Clock::time_point last_proposal,
+                                           Clock::time_point now) const {
+      return queue_size != 0
+          and (queue_size >= proposalSize()
+               or now - last_proposal >= proposalDelay());
+    }
+
+    void ProposalController::onProposal(
+        shared_model::interface::types::TimestampType created_time,
+        Clock::time_point now) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      published_[created_time] = now;
+      if (published_.size() > kMaxPublished) {
+        published_.erase(published_.begin());
+      }
+    }
+
+    void ProposalController::onCommit(
+        shared_model::interface::types::TimestampType created_time,
+        Clock::time_point now) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = published_.find(created_time);
+      if (it == published_.end()) {
+        // the block was not proposed by this ordering service
+        published_.erase(published_.begin(),
+                         published_.upper_bound(created_time));
+        return;
+      }
+
+      auto latency =
+          std::chrono::duration<double, std::milli>(now - it->second).count();
+      // rounds of older proposals are skipped
+      published_.erase(published_.begin(), std::next(it));
+      latency_ = kSmoothing * latency + (1 - kSmoothing) * latency_;
+
+      if (latency_ > bounds_.max_delay.count()) {
+        size_ = std::max(bounds_.min_size, size_ / 2);
+      } else {
+        auto step = std::max<size_t>(
+            1, (bounds_.max_size - bounds_.min_size) / kSizeSteps);
+        size_ = std::min(bounds_.max_size, size_ + step);
+      }
+
+      log_->info(
+          "Proposal created at {} committed in {:.1f} ms, average {:.1f} ms, "
+          "next proposal size {}, delay {} ms",
+          created_time,
+          latency,
+          latency_,
+          size_,
+          currentDelay().count());
+    }
+
+    std::chrono::milliseconds ProposalController::currentDelay() const {
+      auto delay = std::chrono::milliseconds(
+          static_cast<std::chrono::milliseconds::rep>(latency_));
+      return std::min(std::max(delay, bounds_.min_delay), bounds_.max_delay);
+    }
+
+    ProposalController::~ProposalController() {
+      subscription_.unsubscribe();
+    }
+
+  }  // namespace ordering
+}  // namespace iroha
@@ -0,0 +1,136 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_PROPOSAL_CONTROLLER_HPP
+#define IROHA_PROPOSAL_CONTROLLER_HPP
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <rxcpp/rx.hpp>
+
+#include "interfaces/common_objects/types.hpp"
+#include "logger/logger.hpp"
+
+namespace shared_model {
+  namespace interface {
+    class Block;
+  }  // namespace interface
+}  // namespace shared_model
+
+namespace iroha {
+  namespace ordering {
+
+    /**
+     * Bounds of proposal size and delay between proposals for adaptive mode
+     * of ordering service
+     */
+    struct ProposalBounds {
+      size_t min_size;
+      size_t max_size;
+      std::chrono::milliseconds min_delay;
+      std::chrono::milliseconds max_delay;
+    };
+
+    /**
+     * Controller of proposal size and delay between proposals.
+     * Commit latency of a proposal is the time between its publishing and
+     * commit of the block created from it, so it includes stateful
+     * validation and consensus. Proposals and blocks are matched by creation
+     * time, which a block takes from its proposal, since skipped rounds leave
+     * block heights behind proposal heights.
+     * The delay follows the average commit latency, so proposals are not
+     * produced faster than the ledger commits them, and transactions do not
+     * wait for the whole delay when the ledger is fast.
+     * The size is increased additively while the average commit latency fits
+     * the maximal delay, and halved otherwise.
+     * Proposal is generated earlier when the queue has enough transactions
+     * for a proposal of current size.
+     */
+    class ProposalController {
+     public:
+      using Clock = std::chrono::steady_clock;
+
+      /**
+       * @param bounds - bounds of proposal size and delay
+       * @param committed_blocks - observable of committed blocks
+       */
+      ProposalController(
+          ProposalBounds bounds,
+          rxcpp::observable<std::shared_ptr<shared_model::interface::Block>>
+              committed_blocks);
+
+      /**
+       * @return current maximal number of transactions in proposal
+       */
+      size_t proposalSize() const;
+
+      /**
+       * @return current delay between proposals
+       */
+      std::chrono::milliseconds proposalDelay() const;
+
+      /**
+       * @param queue_size - number of queued transactions
+       * @param last_proposal - time of the previous proposal
+       * @param now - current time
+       * @return true if proposal should be generated now
+       */
+      bool shouldPropose(size_t queue_size,
+                         Clock::time_point last_proposal,
+                         Clock::time_point now) const;
+
+      /**
+       * Register published proposal
+       * @param created_time - creation time of proposal
+       * @param now - time of publishing
+       */
+      void onProposal(
+          shared_model::interface::types::TimestampType created_time,
+          Clock::time_point now = Clock::now());
+
+      /**
+       * Register committed block and adjust proposal size and delay
+       * @param created_time - creation time of committed block
+       * @param now - time of commit
+       */
+      void onCommit(
+          shared_model::interface::types::TimestampType created_time,
+          Clock::time_point now = Clock::now());
+
+      ~ProposalController();
+
+     private:
+      /**
+       * @return average commit latency clamped by delay bounds,
+       * mutex_ should be locked
+       */
+      std::chrono::milliseconds currentDelay() const;
+
+      const ProposalBounds bounds_;
+
+      /// current maximal number of transactions in proposal
+      size_t size_;
+
+      /// average commit latency in milliseconds
+      double latency_;
+
+      /// publishing time of proposals waiting for commit by creation time
+      std::map<shared_model::interface::types::TimestampType,
+               Clock::time_point>
+          published_;
+
+      mutable std::mutex mutex_;
+
+      rxcpp::composite_subscription subscription_;
+
+      logger::Logger log_;
+    };
+
+  }  // namespace ordering
+}  // namespace iroha
+
+#endif  // IROHA_PROPOSAL_CONTROLLER_HPP
@@ -0,0 +1,111 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_TX_HASH_BLOOM_FILTER_HPP
+#define IROHA_TX_HASH_BLOOM_FILTER_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace iroha {
+  namespace ordering {
+
+    /**
+     * Bloom filter over transaction hashes.
+     * Hashes are outputs of a cryptographic hash function, so bit indexes are
+     * taken directly from hash bytes by double hashing without rehashing.
+     * Not thread-safe.
+     */
+    class TxHashBloomFilter {
+     public:
+      using Bytes = std::vector<uint8_t>;
+
+      /// bits per expected element, gives ~1% false positive rate
+      static constexpr size_t kBitsPerElement = 10;
+      /// number of bit indexes per element, optimal for kBitsPerElement
+      static constexpr size_t kIndexes = 7;
+
+      /**
+       * @param capacity - expected number of elements, false positive rate
+       * grows when it is exceeded
+       */
+      explicit TxHashBloomFilter(size_t capacity)
+          : capacity_(std::max<size_t>(capacity, 1)),
+            bits_(capacity_ * kBitsPerElement),
+            words_((bits_ + 63) / 64, 0) {}
+
+      /**
+       * Add hash to the filter
+       * @param hash - bytes of transaction hash
+       */
+      void add(const Bytes &hash) {
+        forEachIndex(hash, [this](size_t index) {
+          words_[index / 64] |= uint64_t{1} << (index % 64);
+          return true;
+        });
+        ++size_;
+      }
+
+      /**
+       * @param hash - bytes of transaction hash
+       * @return false if the hash was never added, true if it was probably
+       * added
+       */
+      bool mayContain(const Bytes &hash) const {
+        return forEachIndex(hash, [this](size_t index) {
+          return (words_[index / 64] & (uint64_t{1} << (index % 64))) != 0;
+        });
+      }
+
+      /**
+       * @return number of added hashes
+       */
+      size_t size() const {
+        return size_;
+      }
+
+      /**
+       * @return expected number of elements
+       */
+      size_t capacity() const {
+        return capacity_;
+      }
+
+     private:
+      /**
+       * Apply predicate to every bit index of the hash until it fails
+       * @return true if predicate succeeded for all indexes
+       */
+      template <typename Predicate>
+      bool forEachIndex(const Bytes &hash, Predicate &&predicate) const {
+        uint64_t h1 = 0, h2 = 0;
+        std::memcpy(&h1, hash.data(), std::min(hash.size(), sizeof(h1)));
+        if (hash.size() > sizeof(h1)) {
+          std::memcpy(&h2,
+                      hash.data() + sizeof(h1),
+                      std::min(hash.size() - sizeof(h1), sizeof(h2)));
+        }
+        // odd step visits distinct bits for power of two sizes too
+        h2 |= 1;
+        for (size_t i = 0; i < kIndexes; ++i) {
+          if (not predicate((h1 + i * h2) % bits_)) {
+            return false;
+          }
+        }
+        return true;
+      }
+
+      size_t capacity_;
+      size_t bits_;
+      std::vector<uint64_t> words_;
+      size_t size_{0};
+    };
+
+  }  // namespace ordering
+}  // namespace iroha
+
+#endif  // IROHA_TX_HASH_BLOOM_FILTER_HPP
@@ -17,6 +17,8 @@
 
 #include "simulator/impl/simulator.hpp"
 
+#include <algorithm>
+
 #include <boost/range/adaptor/transformed.hpp>
 
 #include "backend/protobuf/empty_block.hpp"
@@ -34,17 +36,28 @@ namespace iroha {
         std::shared_ptr<ametsuchi::TemporaryFactory> factory,
         std::shared_ptr<ametsuchi::BlockQuery> blockQuery,
         std::shared_ptr<shared_model::crypto::CryptoModelSigner<>>
-            crypto_signer)
-        : validator_(std::move(statefulValidator)),
+            crypto_signer,
+        bool skip_empty_blocks,
+        rxcpp::observe_on_one_worker speculation_worker)
+        : ordering_gate_(std::move(ordering_gate)),
+          validator_(std::move(statefulValidator)),
           ametsuchi_factory_(std::move(factory)),
           block_queries_(std::move(blockQuery)),
-          crypto_signer_(std::move(crypto_signer)) {
+          crypto_signer_(std::move(crypto_signer)),
+          skip_empty_blocks_(skip_empty_blocks) {
       log_ = logger::log("Simulator");
-      ordering_gate->on_proposal().subscribe(
+      ordering_gate_->on_proposal().subscribe(
           proposal_subscription_,
           [this](std::shared_ptr<shared_model::interface::Proposal> proposal) {
             this->process_proposal(*proposal);
           });
+      ordering_gate_->on_speculative_proposal()
+          .observe_on(speculation_worker)
+          .subscribe(speculative_proposal_subscription_,
+                     [this](std::shared_ptr<shared_model::interface::Proposal>
+                                proposal) {
+                       this->process_speculative_proposal(std::move(proposal));
+                     });
 
       notifier_.get_observable().subscribe(
           verified_proposal_subscription_,
@@ -56,6 +69,7 @@ namespace iroha {
 
     Simulator::~Simulator() {
       proposal_subscription_.unsubscribe();
+      speculative_proposal_subscription_.unsubscribe();
       verified_proposal_subscription_.unsubscribe();
     }
 
@@ -83,12 +97,41 @@ namespace iroha {
         return;
       }
 
-      if (last_block->height() + 1 != proposal.height()) {
-        log_->warn("Last block height: {}, proposal height: {}",
+      // skipped rounds leave proposal heights ahead of block heights, so the
+      // round follows the last processed proposal then
+      auto expected_height =
+          std::max(last_block->height(), last_proposal_height_) + 1;
+      // ordering gate restores the round after launch
+      auto after_launch = skip_empty_blocks_ and last_proposal_height_ == 0
+          and proposal.height() > expected_height;
+      if (proposal.height() != expected_height and not after_launch) {
+        log_->warn("Last block height: {}, last proposal height: {}, "
+                   "proposal height: {}",
                    last_block->height(),
+                   last_proposal_height_,
                    proposal.height());
         return;
       }
+      if (skip_empty_blocks_) {
+        last_proposal_height_ = proposal.height();
+      }
+
+      {
+        std::lock_guard<std::mutex> lock(speculation_mutex_);
+        auto speculation = std::move(speculation_);
+        speculation_ = boost::none;
+        if (speculation
+            and (speculation->proposal.get() == &proposal
+                 or *speculation->proposal == proposal)) {
+          if (speculation->block_hash == last_block->hash()) {
+            log_->info("Use result of speculative validation");
+            notifier_.get_subscriber().on_next(speculation->verified_proposal);
+            return;
+          }
+          log_->info("Committed block differs, discard speculative result");
+        }
+      }
+
       auto temporaryStorageResult = ametsuchi_factory_->createTemporaryWsv();
       temporaryStorageResult.match(
           [&](expected::Value<std::unique_ptr<ametsuchi::TemporaryWsv>>
@@ -105,6 +148,36 @@ namespace iroha {
           });
     }
 
+    void Simulator::process_speculative_proposal(
+        std::shared_ptr<shared_model::interface::Proposal> proposal) {
+      std::shared_ptr<shared_model::interface::Block> block;
+      {
+        std::lock_guard<std::mutex> lock(speculation_mutex_);
+        block = candidate_block_;
+      }
+      if (not block or block->height() + 1 != proposal->height()) {
+        log_->info("No block to validate proposal {} on top of",
+                   proposal->height());
+        return;
+      }
+      log_->info("process speculative proposal");
+
+      ametsuchi_factory_->createTemporaryWsv(*block).match(
+          [&](expected::Value<std::unique_ptr<ametsuchi::TemporaryWsv>>
+                  &temporary_storage) {
+            auto verified_proposal =
+                validator_->validate(*proposal, *temporary_storage.value);
+            std::lock_guard<std::mutex> lock(speculation_mutex_);
+            speculation_ =
+                Speculation{proposal, block->hash(), verified_proposal};
+          },
+          [&](expected::Error<std::string> &error) {
+            log_->warn("Cannot validate on top of block {}: {}",
+                       block->height(),
+                       error.error);
+          });
+    }
+
     void Simulator::process_verified_proposal(
         const shared_model::interface::Proposal &proposal) {
       log_->info("process verified proposal");
@@ -121,6 +194,16 @@ namespace iroha {
         block_notifier_.get_subscriber().on_next(any_block);
       };
 
+      if (proto_txs.empty() and skip_empty_blocks_) {
+        // stateful validation is deterministic, so all peers skip the round
+        {
+          std::lock_guard<std::mutex> lock(speculation_mutex_);
+          candidate_block_ = nullptr;
+        }
+        ordering_gate_->skipRound(proposal.height());
+        return;
+      }
+
       if (proto_txs.empty()) {
         auto empty_block = std::make_shared<shared_model::proto::EmptyBlock>(
             shared_model::proto::UnsignedEmptyBlockBuilder()
@@ -129,9 +212,14 @@ namespace iroha {
                 .createdTime(proposal.createdTime())
                 .build());
 
+        {
+          std::lock_guard<std::mutex> lock(speculation_mutex_);
+          candidate_block_ = nullptr;
+        }
         sign_and_send(empty_block);
         return;
       }
+      // the builder is a temporary, so transactions are copied only once
       auto block = std::make_shared<shared_model::proto::Block>(
           shared_model::proto::UnsignedBlockBuilder()
               .height(block_queries_->getTopBlockHeight() + 1)
@@ -140,6 +228,10 @@ namespace iroha {
               .createdTime(proposal.createdTime())
               .build());
 
+      {
+        std::lock_guard<std::mutex> lock(speculation_mutex_);
+        candidate_block_ = block;
+      }
       sign_and_send(block);
     }
 
@@ -19,6 +19,7 @@
 #define IROHA_SIMULATOR_HPP
 
 #include <boost/optional.hpp>
+#include <mutex>
 #include "ametsuchi/block_query.hpp"
 #include "ametsuchi/temporary_factory.hpp"
 #include "cryptography/crypto_provider/crypto_model_signer.hpp"
@@ -33,13 +34,23 @@ namespace iroha {
 
     class Simulator : public VerifiedProposalCreator, public BlockCreator {
      public:
+      /**
+       * @param skip_empty_blocks - whether proposals without valid
+       * transactions finish their round in ordering gate instead of producing
+       * an empty block
+       * @param speculation_worker - worker which validates speculative
+       * proposals, so ordering gate does not wait for validation
+       */
       Simulator(
           std::shared_ptr<network::OrderingGate> ordering_gate,
           std::shared_ptr<validation::StatefulValidator> statefulValidator,
           std::shared_ptr<ametsuchi::TemporaryFactory> factory,
           std::shared_ptr<ametsuchi::BlockQuery> blockQuery,
           std::shared_ptr<shared_model::crypto::CryptoModelSigner<>>
-              crypto_signer);
+              crypto_signer,
+          bool skip_empty_blocks = false,
+          rxcpp::observe_on_one_worker speculation_worker =
+              rxcpp::observe_on_new_thread());
 
       Simulator(const Simulator &) = delete;
       Simulator &operator=(const Simulator &) = delete;
@@ -49,6 +60,19 @@ namespace iroha {
       void process_proposal(
           const shared_model::interface::Proposal &proposal) override;
 
+      /**
+       * Validate proposal on top of the block built by this peer, which is
+       * not committed yet. The result is used by process_proposal if the
+       * block gets committed.
+       *
+       * Temporary storage reads a snapshot, which contains the block if it
+       * was committed already, and applies the block otherwise. The commit
+       * of the block waits until the validation releases the storage.
+       * @param proposal - proposal following the block
+       */
+      void process_speculative_proposal(
+          std::shared_ptr<shared_model::interface::Proposal> proposal);
+
       rxcpp::observable<std::shared_ptr<shared_model::interface::Proposal>>
       on_verified_proposal() override;
 
@@ -67,17 +91,38 @@ namespace iroha {
           block_notifier_;
 
       rxcpp::composite_subscription proposal_subscription_;
+      rxcpp::composite_subscription speculative_proposal_subscription_;
       rxcpp::composite_subscription verified_proposal_subscription_;
 
+      std::shared_ptr<network::OrderingGate> ordering_gate_;
       std::shared_ptr<validation::StatefulValidator> validator_;
       std::shared_ptr<ametsuchi::TemporaryFactory> ametsuchi_factory_;
       std::shared_ptr<ametsuchi::BlockQuery> block_queries_;
       std::shared_ptr<shared_model::crypto::CryptoModelSigner<>> crypto_signer_;
+      bool skip_empty_blocks_;
 
       logger::Logger log_;
 
       // last block
       std::shared_ptr<shared_model::interface::Block> last_block;
+
+      /// height of the last processed proposal when empty blocks are skipped
+      shared_model::interface::types::HeightType last_proposal_height_{0};
+
+      /**
+       * Result of speculative validation of a proposal
+       */
+      struct Speculation {
+        std::shared_ptr<shared_model::interface::Proposal> proposal;
+        /// hash of the block the proposal was validated on top of
+        shared_model::interface::types::HashType block_hash;
+        std::shared_ptr<shared_model::interface::Proposal> verified_proposal;
+      };
+
+      /// the last block built by this peer, null for empty block
+      std::shared_ptr<shared_model::interface::Block> candidate_block_;
+      boost::optional<Speculation> speculation_;
+      std::mutex speculation_mutex_;
     };
   }  // namespace simulator
 }  // namespace iroha
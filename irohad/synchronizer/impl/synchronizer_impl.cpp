@@ -15,6 +15,7 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <utility>
 #include "backend/protobuf/block.hpp"
 #include "backend/protobuf/empty_block.hpp"
@@ -26,14 +27,18 @@
 namespace iroha {
   namespace synchronizer {
 
+    constexpr size_t SynchronizerImpl::kDefaultChunkSize;
+
     SynchronizerImpl::SynchronizerImpl(
         std::shared_ptr<network::ConsensusGate> consensus_gate,
         std::shared_ptr<validation::ChainValidator> validator,
         std::shared_ptr<ametsuchi::MutableFactory> mutableFactory,
-        std::shared_ptr<network::BlockLoader> blockLoader)
+        std::shared_ptr<network::BlockLoader> blockLoader,
+        size_t chunk_size)
         : validator_(std::move(validator)),
           mutableFactory_(std::move(mutableFactory)),
-          blockLoader_(std::move(blockLoader)) {
+          blockLoader_(std::move(blockLoader)),
+          chunk_size_(std::max<size_t>(chunk_size, 1)) {
       log_ = logger::log("synchronizer");
       consensus_gate->on_commit().subscribe(
           subscription_,
@@ -49,15 +54,7 @@ namespace iroha {
     void SynchronizerImpl::process_commit(
         const shared_model::interface::BlockVariant &commit_message_variant) {
       log_->info("processing commit");
-      auto storageResult = mutableFactory_->createMutableStorage();
-      std::unique_ptr<ametsuchi::MutableStorage> storage;
-      storageResult.match(
-          [&](expected::Value<std::unique_ptr<ametsuchi::MutableStorage>>
-                  &_storage) { storage = std::move(_storage.value); },
-          [&](expected::Error<std::string> &error) {
-            storage = nullptr;
-            log_->error(error.error);
-          });
+      auto storage = createStorage();
       if (not storage) {
         return;
       }
@@ -86,36 +83,15 @@ namespace iroha {
         notifier_.get_subscriber().on_next(single_commit);
       } else {
         // Block can't be applied to current storage
-        // Download all missing blocks
+        // Download all missing blocks from peers which signed the commit
+        storage.reset();
+        std::vector<shared_model::crypto::PublicKey> signers;
         for (const auto &signature : commit_message->signatures()) {
-          auto storageResult = mutableFactory_->createMutableStorage();
-          std::unique_ptr<ametsuchi::MutableStorage> storage;
-          storageResult.match(
-              [&](expected::Value<std::unique_ptr<ametsuchi::MutableStorage>>
-                      &_storage) { storage = std::move(_storage.value); },
-              [&](expected::Error<std::string> &error) {
-                storage = nullptr;
-                log_->error(error.error);
-              });
-          if (not storage) {
-            return;
-          }
-          auto network_chain = blockLoader_->retrieveBlocks(
-              shared_model::crypto::PublicKey(signature.publicKey()));
-          // Check chain last commit
-          std::vector<std::shared_ptr<shared_model::interface::Block>> blocks;
-          network_chain.as_blocking().subscribe(
-              [&blocks](auto block) { blocks.push_back(block); });
-          auto is_chain_end_expected =
-              blocks.back()->hash() == commit_message->hash();
-          auto chain =
-              rxcpp::observable<>::iterate(blocks, rxcpp::identity_immediate());
-
-          if (validator_->validateChain(chain, *storage)
-              and is_chain_end_expected) {
-            // Peer send valid chain
-            mutableFactory_->commit(std::move(storage));
-            notifier_.get_subscriber().on_next(chain);
+          signers.emplace_back(signature.publicKey());
+        }
+        // every attempt splits the rest of the chain between all signers
+        for (size_t attempt = 0; attempt < signers.size(); ++attempt) {
+          if (downloadChain(signers, *commit_message)) {
             // You are synchronized
             return;
           }
@@ -123,6 +99,82 @@ namespace iroha {
       }
     }
 
+    std::unique_ptr<ametsuchi::MutableStorage>
+    SynchronizerImpl::createStorage() {
+      std::unique_ptr<ametsuchi::MutableStorage> storage;
+      mutableFactory_->createMutableStorage().match(
+          [&](expected::Value<std::unique_ptr<ametsuchi::MutableStorage>>
+                  &_storage) { storage = std::move(_storage.value); },
+          [&](expected::Error<std::string> &error) {
+            log_->error(error.error);
+          });
+      return storage;
+    }
+
+    bool SynchronizerImpl::downloadChain(
+        const std::vector<shared_model::crypto::PublicKey> &signers,
+        const shared_model::interface::Block &commit_message) {
+      const auto target_height = commit_message.height();
+      BlockChunk chunk;
+      chunk.reserve(chunk_size_);
+      bool failed = false;
+      bool synchronized = false;
+
+      auto flush = [&] {
+        // the rest of the chain is committed only if it ends with the
+        // committed block, otherwise the peer is not trusted with it
+        synchronized = chunk.back()->hash() == commit_message.hash();
+        failed = not commitChunk(chunk,
+                                 chunk.size() == chunk_size_ or synchronized);
+        if (not failed) {
+          log_->info("Committed blocks {}-{}, target height {}",
+                     chunk.front()->height(),
+                     chunk.back()->height(),
+                     target_height);
+        }
+        chunk.clear();
+      };
+
+      // stop the download as soon as a chunk is rejected
+      blockLoader_->retrieveChain(signers, target_height)
+          .take_while([&failed](const auto &) { return not failed; })
+          .as_blocking()
+          .subscribe(
+              [&](std::shared_ptr<shared_model::interface::Block> block) {
+                chunk.push_back(std::move(block));
+                if (chunk.size() == chunk_size_) {
+                  flush();
+                }
+              });
+      if (not failed and not chunk.empty()) {
+        flush();
+      }
+      return not failed and synchronized;
+    }
+
+    bool SynchronizerImpl::commitChunk(const BlockChunk &chunk,
+                                       bool is_complete) {
+      auto storage = createStorage();
+      if (not storage) {
+        return false;
+      }
+      auto chain =
+          rxcpp::observable<>::iterate(chunk, rxcpp::identity_immediate());
+      if (not validator_->validateChain(chain, *storage)) {
+        log_->warn("Chain from height {} is not valid",
+                   chunk.front()->height());
+        return false;
+      }
+      if (not is_complete) {
+        log_->warn("Chain ends at height {} with unexpected block",
+                   chunk.back()->height());
+        return false;
+      }
+      mutableFactory_->commit(std::move(storage));
+      notifier_.get_subscriber().on_next(chain);
+      return true;
+    }
+
     rxcpp::observable<Commit> SynchronizerImpl::on_commit_chain() {
       return notifier_.get_observable();
     }
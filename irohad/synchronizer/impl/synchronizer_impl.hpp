@@ -28,11 +28,19 @@ namespace iroha {
   namespace synchronizer {
     class SynchronizerImpl : public Synchronizer {
      public:
+      /// number of downloaded blocks validated and committed at once
+      static constexpr size_t kDefaultChunkSize = 100;
+
+      /**
+       * @param chunk_size - number of downloaded blocks which are kept in
+       * memory, validated and committed together
+       */
       SynchronizerImpl(
           std::shared_ptr<network::ConsensusGate> consensus_gate,
           std::shared_ptr<validation::ChainValidator> validator,
           std::shared_ptr<ametsuchi::MutableFactory> mutableFactory,
-          std::shared_ptr<network::BlockLoader> blockLoader);
+          std::shared_ptr<network::BlockLoader> blockLoader,
+          size_t chunk_size = kDefaultChunkSize);
 
       ~SynchronizerImpl();
 
@@ -42,9 +50,40 @@ namespace iroha {
       rxcpp::observable<Commit> on_commit_chain() override;
 
      private:
+      using BlockChunk =
+          std::vector<std::shared_ptr<shared_model::interface::Block>>;
+
+      /**
+       * Create mutable storage, log the error if it fails
+       * @return storage or nullptr
+       */
+      std::unique_ptr<ametsuchi::MutableStorage> createStorage();
+
+      /**
+       * Download missing blocks up to the committed one. Blocks are validated
+       * and committed in chunks as they arrive, so an interrupted download
+       * keeps all committed chunks and the next one resumes after them.
+       * @param signers - peers to download blocks from
+       * @param commit_message - block committed by consensus
+       * @return true if the committed block is reached
+       */
+      bool downloadChain(
+          const std::vector<shared_model::crypto::PublicKey> &signers,
+          const shared_model::interface::Block &commit_message);
+
+      /**
+       * Validate chunk of blocks on a new mutable storage, commit and notify
+       * subscribers about it
+       * @param is_complete - whether the chunk is full or ends with the
+       * committed block, otherwise it is validated but not committed
+       * @return true if the chunk is committed
+       */
+      bool commitChunk(const BlockChunk &chunk, bool is_complete);
+
       std::shared_ptr<validation::ChainValidator> validator_;
       std::shared_ptr<ametsuchi::MutableFactory> mutableFactory_;
       std::shared_ptr<network::BlockLoader> blockLoader_;
+      size_t chunk_size_;
 
       // internal
       rxcpp::subjects::subject<Commit> notifier_;
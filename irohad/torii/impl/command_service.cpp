@@ -70,7 +70,12 @@ namespace torii {
                 iroha::expected::Value<shared_model::proto::Transaction>
                     &iroha_tx) {
               tx_hash = iroha_tx.value.hash();
-              if (cache_->findItem(tx_hash) and iroha_tx.value.quorum() < 2) {
+              auto cached_response = cache_->findItem(tx_hash);
+              // overloaded transactions are allowed to be resubmitted
+              if (cached_response
+                  and cached_response->tx_status()
+                      != iroha::protocol::TxStatus::OVERLOADED
+                  and iroha_tx.value.quorum() < 2) {
                 log_->warn("Found transaction {} in cache, ignoring",
                            tx_hash.hex());
                 return;
@@ -278,7 +283,8 @@ namespace torii {
         TxStatus::STATELESS_VALIDATION_FAILED,
         TxStatus::STATEFUL_VALIDATION_FAILED,
         TxStatus::NOT_RECEIVED,
-        TxStatus::COMMITTED};
+        TxStatus::COMMITTED,
+        TxStatus::OVERLOADED};
     return (std::find(
                std::begin(final_statuses), std::end(final_statuses), status))
         != std::end(final_statuses);
@@ -95,6 +95,17 @@ namespace iroha {
             });
       });
 
+      // notify about txs rejected by overloaded ordering service
+      pcs_->on_rejected_transaction().subscribe([this](const auto &tx_hash) {
+        log_->info("on ordering service overloaded: {}", tx_hash.hex());
+        std::lock_guard<std::mutex> lock(notifier_mutex_);
+        notifier_.get_subscriber().on_next(
+            shared_model::builder::DefaultTransactionStatusBuilder()
+                .overloaded()
+                .txHash(tx_hash)
+                .build());
+      });
+
       mst_processor_->onPreparedTransactions().subscribe([this](auto &&tx) {
         log_->info("MST tx prepared");
         return this->pcs_->propagate_transaction(tx);
@@ -17,15 +17,64 @@
 
 #include "validation/impl/stateful_validator_impl.hpp"
 
+#include <algorithm>
+#include <mutex>
+#include <numeric>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+
 #include <boost/range/adaptor/filtered.hpp>
 #include <boost/range/adaptor/transformed.hpp>
+#include <boost/range/irange.hpp>
 #include "builders/protobuf/proposal.hpp"
+#include "validation/transaction_conflicts.hpp"
 #include "validation/utils.hpp"
 
 namespace iroha {
   namespace validation {
 
-    StatefulValidatorImpl::StatefulValidatorImpl() {
+    namespace {
+      using shared_model::interface::types::AccountIdType;
+
+      /**
+       * Account and signatories of a transaction creator
+       */
+      struct CreatorState {
+        std::shared_ptr<shared_model::interface::Account> account;
+        PublicKeySet signatories;
+      };
+
+      using CreatorStates = std::unordered_map<AccountIdType, CreatorState>;
+
+      /**
+       * Load accounts and signatories of creators with one query each
+       * @return states of existing accounts
+       */
+      boost::optional<CreatorStates> loadCreators(
+          const std::vector<AccountIdType> &creators,
+          ametsuchi::WsvQuery &queries) {
+        return queries.getAccounts(creators) | [&](const auto &accounts) {
+          return queries.getAccountsSignatories(creators) |
+              [&](const auto &signatories) {
+                CreatorStates states;
+                for (const auto &account : accounts) {
+                  states[account->accountId()].account = account;
+                }
+                for (const auto &signatory : signatories) {
+                  auto state = states.find(signatory.first);
+                  if (state != states.end()) {
+                    state->second.signatories.insert(signatory.second.hex());
+                  }
+                }
+                return boost::make_optional(std::move(states));
+              };
+        };
+      }
+    }  // namespace
+
+    StatefulValidatorImpl::StatefulValidatorImpl(size_t max_workers)
+        : max_workers_(std::max<size_t>(max_workers, 1)) {
       log_ = logger::log("SFV");
     }
 
@@ -35,7 +84,36 @@ namespace iroha {
         ametsuchi::TemporaryWsv &temporaryWsv) {
       log_->info("transactions in proposal: {}",
                  proposal.transactions().size());
-      auto checking_transaction = [](const auto &tx, auto &queries) {
+      TransactionList transactions;
+      for (const auto &tx : proposal.transactions()) {
+        transactions.push_back(&tx);
+      }
+      std::vector<AccessedKeys> keys;
+      keys.reserve(transactions.size());
+      for (const auto *tx : transactions) {
+        keys.push_back(accessedKeys(*tx));
+      }
+
+      auto creators = unchangedCreators(transactions, keys);
+      std::once_flag creators_loaded;
+      boost::optional<CreatorStates> creator_states;
+      auto checking_transaction = [&](const auto &tx, auto &queries) {
+        // the first call is made before any transaction is applied, and
+        // loaded creators are not changed by transactions of the proposal
+        std::call_once(creators_loaded, [&] {
+          if (not creators.empty()) {
+            creator_states = loadCreators(creators, queries);
+          }
+        });
+        if (creator_states) {
+          auto state = creator_states->find(tx.creatorAccountId());
+          if (state != creator_states->end()) {
+            return boost::size(tx.signatures())
+                >= state->second.account->quorum()
+                and signaturesSubset(tx.signatures(),
+                                     state->second.signatories);
+          }
+        }
         return bool(queries.getAccount(tx.creatorAccountId()) |
                     [&](const auto &account) {
                       // Check if tx creator has account and has quorum to
@@ -54,30 +132,123 @@ namespace iroha {
                     });
       };
 
-      // Filter only valid transactions
-      auto filter = [&temporaryWsv, checking_transaction](auto &tx) {
-        return temporaryWsv.apply(tx, checking_transaction);
+      auto workers = scheduleWorkers(keys);
+      // forks are created before the first worker changes the state
+      std::vector<std::unique_ptr<ametsuchi::TemporaryWsv>> forks;
+      for (size_t i = 1; i < workers.size(); ++i) {
+        temporaryWsv.fork().match(
+            [&forks](expected::Value<std::unique_ptr<ametsuchi::TemporaryWsv>>
+                         &fork) { forks.push_back(std::move(fork.value)); },
+            [this](const expected::Error<std::string> &error) {
+              log_->warn("Cannot fork temporary wsv: {}", error.error);
+            });
+      }
+      if (forks.size() + 1 != workers.size()) {
+        // validate serially, if some of forks are not available
+        forks.clear();
+        workers = {std::vector<size_t>(transactions.size())};
+        std::iota(workers.front().begin(), workers.front().end(), 0);
+      }
+
+      // every worker writes results of its own transactions only
+      std::vector<uint8_t> valid(transactions.size(), false);
+      auto validate_transactions = [&](ametsuchi::TemporaryWsv &wsv,
+                                       const std::vector<size_t> &indices) {
+        for (auto i : indices) {
+          valid[i] = wsv.apply(*transactions[i], checking_transaction);
+        }
       };
+      std::vector<std::thread> threads;
+      for (size_t i = 1; i < workers.size(); ++i) {
+        threads.emplace_back(validate_transactions,
+                             std::ref(*forks[i - 1]),
+                             std::cref(workers[i]));
+      }
+      validate_transactions(temporaryWsv, workers.front());
+      for (auto &thread : threads) {
+        thread.join();
+      }
 
       // TODO: kamilsa IR-1010 20.02.2018 rework validation logic, so that this
       // cast is not needed and stateful validator does not know about the
       // transport
       auto valid_proto_txs =
-          proposal.transactions() | boost::adaptors::filtered(filter)
-          | boost::adaptors::transformed([](auto &tx) {
-              return static_cast<const shared_model::proto::Transaction &>(tx);
+          boost::irange<size_t>(0, transactions.size())
+          | boost::adaptors::filtered([&valid](auto i) { return valid[i]; })
+          | boost::adaptors::transformed([&transactions](auto i) {
+              return static_cast<const shared_model::proto::Transaction &>(
+                  *transactions[i]);
             });
-      auto validated_proposal = shared_model::proto::ProposalBuilder()
-                                    .createdTime(proposal.createdTime())
-                                    .height(proposal.height())
-                                    .transactions(valid_proto_txs)
-                                    .createdTime(proposal.createdTime())
-                                    .build();
+      // the builder is a temporary, so transactions are copied only once
+      auto validated_proposal =
+          std::make_shared<shared_model::proto::Proposal>(
+              shared_model::proto::ProposalBuilder()
+                  .createdTime(proposal.createdTime())
+                  .height(proposal.height())
+                  .transactions(valid_proto_txs)
+                  .build());
 
       log_->info("transactions in verified proposal: {}",
-                 validated_proposal.transactions().size());
-      return std::make_shared<decltype(validated_proposal)>(
-          validated_proposal.getTransport());
+                 validated_proposal->transactions().size());
+      return validated_proposal;
+    }
+
+    std::vector<AccountIdType> StatefulValidatorImpl::unchangedCreators(
+        const TransactionList &transactions,
+        const std::vector<AccessedKeys> &keys) const {
+      std::unordered_set<std::string> written;
+      for (const auto &tx_keys : keys) {
+        written.insert(tx_keys.writes.begin(), tx_keys.writes.end());
+      }
+      std::unordered_set<AccountIdType> seen;
+      std::vector<AccountIdType> creators;
+      for (const auto *tx : transactions) {
+        const auto &creator = tx->creatorAccountId();
+        if (written.count(accountKey(creator)) == 0
+            and seen.insert(creator).second) {
+          creators.push_back(creator);
+        }
+      }
+      return creators;
+    }
+
+    std::vector<std::vector<size_t>> StatefulValidatorImpl::scheduleWorkers(
+        const std::vector<AccessedKeys> &keys) const {
+      std::vector<std::vector<size_t>> groups;
+      if (max_workers_ > 1 and keys.size() > 1) {
+        groups = independentGroups(keys);
+      }
+      if (groups.size() < 2) {
+        std::vector<size_t> all(keys.size());
+        std::iota(all.begin(), all.end(), 0);
+        return {all};
+      }
+
+      // the largest groups are assigned first to the least loaded worker,
+      // ties are broken by index, so the schedule is deterministic
+      std::stable_sort(
+          groups.begin(), groups.end(), [](const auto &lhs, const auto &rhs) {
+            return lhs.size() > rhs.size();
+          });
+      std::vector<std::vector<size_t>> workers(
+          std::min(max_workers_, groups.size()));
+      for (const auto &group : groups) {
+        auto worker = std::min_element(
+            workers.begin(),
+            workers.end(),
+            [](const auto &lhs, const auto &rhs) {
+              return lhs.size() < rhs.size();
+            });
+        worker->insert(worker->end(), group.begin(), group.end());
+      }
+      for (auto &worker : workers) {
+        std::sort(worker.begin(), worker.end());
+      }
+      log_->info("{} independent groups of transactions are validated by {} "
+                 "workers",
+                 groups.size(),
+                 workers.size());
+      return workers;
     }
   }  // namespace validation
 }  // namespace iroha
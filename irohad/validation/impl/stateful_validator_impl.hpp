@@ -19,7 +19,10 @@
 
 #include "validation/stateful_validator.hpp"
 
+#include <vector>
+
 #include "logger/logger.hpp"
+#include "validation/transaction_conflicts.hpp"
 
 namespace iroha {
   namespace validation {
@@ -29,7 +32,12 @@ namespace iroha {
      */
     class StatefulValidatorImpl : public StatefulValidator {
      public:
-      StatefulValidatorImpl();
+      /**
+       * @param max_workers - maximal number of threads which validate
+       * independent transactions of a proposal concurrently, each of them on
+       * a fork of the temporary wsv. 1 validates all transactions serially
+       */
+      explicit StatefulValidatorImpl(size_t max_workers = 1);
 
       /**
        * Function perform stateful validation on proposal
@@ -44,6 +52,33 @@ namespace iroha {
           const shared_model::interface::Proposal &proposal,
           ametsuchi::TemporaryWsv &temporaryWsv) override;
 
+     private:
+      using TransactionList =
+          std::vector<const shared_model::interface::Transaction *>;
+
+      /**
+       * Find creators of transactions, whose accounts and signatories are
+       * not changed by any transaction of the proposal, so they can be
+       * loaded once for the whole proposal
+       * @param transactions - transactions of the proposal
+       * @param keys - accessed keys of the transactions
+       * @return distinct account ids of creators
+       */
+      std::vector<shared_model::interface::types::AccountIdType>
+      unchangedCreators(const TransactionList &transactions,
+                        const std::vector<AccessedKeys> &keys) const;
+
+      /**
+       * Split transactions between workers, so that conflicting
+       * transactions are validated by the same worker in original order
+       * @param keys - accessed keys of transactions in original order
+       * @return indices of transactions of every worker in ascending order
+       */
+      std::vector<std::vector<size_t>> scheduleWorkers(
+          const std::vector<AccessedKeys> &keys) const;
+
+      size_t max_workers_;
+
       logger::Logger log_;
     };
   }  // namespace validation
@@ -0,0 +1,244 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "validation/transaction_conflicts.hpp"
+
+#include <numeric>
+#include <unordered_map>
+
+#include <boost/optional.hpp>
+#include <boost/variant/apply_visitor.hpp>
+#include <boost/variant/static_visitor.hpp>
+
+#include "interfaces/commands/command.hpp"
+#include "interfaces/transaction.hpp"
+
+namespace {
+  using namespace shared_model::interface;
+  using iroha::validation::accountKey;
+
+  std::string assetKey(const types::AssetIdType &asset_id) {
+    return "asset:" + asset_id;
+  }
+
+  std::string accountAssetKey(const types::AccountIdType &account_id,
+                              const types::AssetIdType &asset_id) {
+    return "account_asset:" + account_id + "/" + asset_id;
+  }
+
+  std::string domainKey(const types::DomainIdType &domain_id) {
+    return "domain:" + domain_id;
+  }
+
+  std::string signatoryKey(const types::PubkeyType &pubkey) {
+    return "signatory:" + pubkey.hex();
+  }
+
+  /**
+   * Collects keys accessed by a command, permissions of the creator are
+   * covered by read of its account
+   */
+  class KeysCollector : public boost::static_visitor<void> {
+   public:
+    explicit KeysCollector(iroha::validation::AccessedKeys &keys)
+        : keys_(keys) {}
+
+    void operator()(const AddAssetQuantity &command) const {
+      read(assetKey(command.assetId()));
+      read(accountKey(command.accountId()));
+      write(accountAssetKey(command.accountId(), command.assetId()));
+    }
+
+    void operator()(const AddPeer &command) const {
+      write("peers");
+    }
+
+    void operator()(const AddSignatory &command) const {
+      write(accountKey(command.accountId()));
+      write(signatoryKey(command.pubkey()));
+    }
+
+    void operator()(const AppendRole &command) const {
+      keys_.global = true;
+    }
+
+    void operator()(const CreateAccount &command) const {
+      read(domainKey(command.domainId()));
+      write(accountKey(command.accountName() + "@" + command.domainId()));
+      write(signatoryKey(command.pubkey()));
+    }
+
+    void operator()(const CreateAsset &command) const {
+      read(domainKey(command.domainId()));
+      write(assetKey(command.assetName() + "#" + command.domainId()));
+    }
+
+    void operator()(const CreateDomain &command) const {
+      write(domainKey(command.domainId()));
+    }
+
+    void operator()(const CreateRole &command) const {
+      keys_.global = true;
+    }
+
+    void operator()(const DetachRole &command) const {
+      keys_.global = true;
+    }
+
+    void operator()(const GrantPermission &command) const {
+      keys_.global = true;
+    }
+
+    void operator()(const RemoveSignatory &command) const {
+      write(accountKey(command.accountId()));
+      write(signatoryKey(command.pubkey()));
+    }
+
+    void operator()(const RevokePermission &command) const {
+      keys_.global = true;
+    }
+
+    void operator()(const SetAccountDetail &command) const {
+      write(accountKey(command.accountId()));
+    }
+
+    void operator()(const SetQuorum &command) const {
+      write(accountKey(command.accountId()));
+    }
+
+    void operator()(const SubtractAssetQuantity &command) const {
+      read(assetKey(command.assetId()));
+      read(accountKey(command.accountId()));
+      write(accountAssetKey(command.accountId(), command.assetId()));
+    }
+
+    void operator()(const TransferAsset &command) const {
+      read(assetKey(command.assetId()));
+      read(accountKey(command.srcAccountId()));
+      read(accountKey(command.destAccountId()));
+      write(accountAssetKey(command.srcAccountId(), command.assetId()));
+      write(accountAssetKey(command.destAccountId(), command.assetId()));
+    }
+
+   private:
+    void read(std::string key) const {
+      keys_.reads.push_back(std::move(key));
+    }
+
+    void write(std::string key) const {
+      keys_.writes.push_back(std::move(key));
+    }
+
+    iroha::validation::AccessedKeys &keys_;
+  };
+
+  /**
+   * Disjoint sets of transaction indices
+   */
+  class DisjointSets {
+   public:
+    explicit DisjointSets(size_t size) : parents_(size) {
+      std::iota(parents_.begin(), parents_.end(), 0);
+    }
+
+    size_t find(size_t element) {
+      while (parents_[element] != element) {
+        parents_[element] = parents_[parents_[element]];
+        element = parents_[element];
+      }
+      return element;
+    }
+
+    void unite(size_t lhs, size_t rhs) {
+      lhs = find(lhs);
+      rhs = find(rhs);
+      // the smallest index is the root, so the result does not depend on
+      // order of unions
+      if (lhs < rhs) {
+        parents_[rhs] = lhs;
+      } else {
+        parents_[lhs] = rhs;
+      }
+    }
+
+   private:
+    std::vector<size_t> parents_;
+  };
+}  // namespace
+
+namespace iroha {
+  namespace validation {
+
+    std::string accountKey(
+        const shared_model::interface::types::AccountIdType &account_id) {
+      return "account:" + account_id;
+    }
+
+    AccessedKeys accessedKeys(
+        const shared_model::interface::Transaction &transaction) {
+      AccessedKeys keys;
+      // signatories, quorum and permissions of the creator are checked
+      keys.reads.push_back(accountKey(transaction.creatorAccountId()));
+      KeysCollector collector(keys);
+      for (const auto &command : transaction.commands()) {
+        boost::apply_visitor(collector, command.get());
+      }
+      return keys;
+    }
+
+    std::vector<std::vector<size_t>> independentGroups(
+        const std::vector<AccessedKeys> &keys) {
+      struct KeyAccess {
+        std::vector<size_t> transactions;
+        bool written = false;
+      };
+      std::unordered_map<std::string, KeyAccess> accesses;
+      DisjointSets sets(keys.size());
+      boost::optional<size_t> first_global;
+
+      for (size_t i = 0; i < keys.size(); ++i) {
+        if (keys[i].global and not first_global) {
+          first_global = i;
+        }
+        for (const auto &key : keys[i].reads) {
+          accesses[key].transactions.push_back(i);
+        }
+        for (const auto &key : keys[i].writes) {
+          auto &access = accesses[key];
+          access.transactions.push_back(i);
+          access.written = true;
+        }
+      }
+
+      // transactions which only read the same key do not conflict
+      for (const auto &access : accesses) {
+        if (access.second.written) {
+          for (auto i : access.second.transactions) {
+            sets.unite(access.second.transactions.front(), i);
+          }
+        }
+      }
+      // transaction which changes permissions conflicts with all others
+      if (first_global) {
+        for (size_t i = 0; i < keys.size(); ++i) {
+          sets.unite(*first_global, i);
+        }
+      }
+
+      std::vector<std::vector<size_t>> groups;
+      std::unordered_map<size_t, size_t> group_by_root;
+      for (size_t i = 0; i < keys.size(); ++i) {
+        auto root = sets.find(i);
+        auto group = group_by_root.emplace(root, groups.size());
+        if (group.second) {
+          groups.emplace_back();
+        }
+        groups[group.first->second].push_back(i);
+      }
+      return groups;
+    }
+
+  }  // namespace validation
+}  // namespace iroha
@@ -0,0 +1,67 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_VALIDATION_TRANSACTION_CONFLICTS_HPP
+#define IROHA_VALIDATION_TRANSACTION_CONFLICTS_HPP
+
+#include <string>
+#include <vector>
+
+#include "interfaces/common_objects/types.hpp"
+
+namespace shared_model {
+  namespace interface {
+    class Transaction;
+  }  // namespace interface
+}  // namespace shared_model
+
+namespace iroha {
+  namespace validation {
+
+    /**
+     * Parts of world state which are read or written by stateful validation
+     * and execution of a transaction
+     */
+    struct AccessedKeys {
+      std::vector<std::string> reads;
+      std::vector<std::string> writes;
+      /// transaction changes roles or permissions, which may affect
+      /// validation of any other transaction
+      bool global = false;
+    };
+
+    /**
+     * @param account_id - id of account
+     * @return key which is written by commands changing the account, its
+     * quorum or signatories
+     */
+    std::string accountKey(
+        const shared_model::interface::types::AccountIdType &account_id);
+
+    /**
+     * Derive keys of accounts, assets, domains, signatories and peers which
+     * the transaction accesses, including its creator account
+     * @param transaction - transaction to analyze
+     * @return accessed keys
+     */
+    AccessedKeys accessedKeys(
+        const shared_model::interface::Transaction &transaction);
+
+    /**
+     * Split transactions into groups, such that no key written by a
+     * transaction of a group is accessed by transactions of other groups.
+     * Groups can be validated independently in any order with the same
+     * result as all transactions in original order.
+     * @param keys - accessed keys of transactions in original order
+     * @return indices of transactions of every group in ascending order,
+     * groups are ordered by their first transaction
+     */
+    std::vector<std::vector<size_t>> independentGroups(
+        const std::vector<AccessedKeys> &keys);
+
+  }  // namespace validation
+}  // namespace iroha
+
+#endif  // IROHA_VALIDATION_TRANSACTION_CONFLICTS_HPP
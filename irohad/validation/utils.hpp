@@ -5,6 +5,7 @@
 
 #include <boost/range/any_range.hpp>
 #include <string>
+#include <unordered_set>
 #include <vector>
 #include "cryptography/public_key.hpp"
 #include "interfaces/common_objects/types.hpp"
@@ -35,5 +36,26 @@ namespace iroha {
           });
     }
 
+    /// hex strings of public keys, which are looked up in constant time
+    using PublicKeySet = std::unordered_set<std::string>;
+
+    /**
+     * Checks if signatures' public keys are present in set of pubkeys
+     * @param signatures - collection of signatures
+     * @param public_keys - set of public keys
+     * @return true, if all public keys of signatures are present in set of
+     * pubkeys
+     */
+    inline bool signaturesSubset(
+        const shared_model::interface::types::SignatureRangeType &signatures,
+        const PublicKeySet &public_keys) {
+      return std::all_of(
+          signatures.begin(),
+          signatures.end(),
+          [&public_keys](const auto &signature) {
+            return public_keys.count(signature.publicKey().hex()) != 0;
+          });
+    }
+
   }  // namespace validation
 }  // namespace iroha
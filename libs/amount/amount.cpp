@@ -17,9 +17,11 @@
 
 #include "amount/amount.hpp"
 
-#include <regex>
+#include <algorithm>
 #include <utility>
 
+#include "validators/field_scanners.hpp"
+
 using namespace boost::multiprecision;
 
 namespace iroha {
@@ -98,8 +100,7 @@ namespace iroha {
 
   boost::optional<Amount> Amount::createFromString(std::string str_amount) {
     // check if valid number
-    std::regex e("([0-9]*\\.[0-9]+|[0-9]+)");
-    if (!std::regex_match(str_amount, e)) {
+    if (not shared_model::validation::scanners::isAmount(str_amount)) {
       return boost::none;
     }
 
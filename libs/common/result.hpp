@@ -19,6 +19,7 @@
 #define IROHA_RESULT_HPP
 
 #include <ciso646>
+#include <memory>
 
 #include <boost/optional.hpp>
 #include <boost/variant.hpp>
@@ -0,0 +1,37 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_TIMER_OBSERVABLE_HPP
+#define IROHA_TIMER_OBSERVABLE_HPP
+
+#include <rxcpp/rx.hpp>
+
+#include "timer/timer_wheel.hpp"
+
+namespace iroha {
+  namespace timer {
+
+    /**
+     * Cold observable which emits sequential numbers every period on the
+     * thread of the wheel. Every subscription schedules its own periodic
+     * task, which is cancelled on unsubscribe
+     * @param wheel - timer service
+     * @param period - interval between emissions
+     */
+    inline rxcpp::observable<long> interval(std::shared_ptr<TimerWheel> wheel,
+                                            std::chrono::milliseconds period) {
+      return rxcpp::observable<>::create<long>(
+          [wheel = std::move(wheel), period](rxcpp::subscriber<long> s) {
+            auto counter = std::make_shared<long>(0);
+            auto handle = wheel->schedulePeriodic(
+                period, [s, counter] { s.on_next((*counter)++); });
+            s.add([handle] { handle.cancel(); });
+          });
+    }
+
+  }  // namespace timer
+}  // namespace iroha
+
+#endif  // IROHA_TIMER_OBSERVABLE_HPP
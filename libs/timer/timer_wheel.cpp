@@ -0,0 +1,150 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "timer/timer_wheel.hpp"
+
+#include <algorithm>
+
+namespace iroha {
+  namespace timer {
+
+    struct TimerHandle::Task {
+      Task(std::function<void()> function, size_t period)
+          : function(std::move(function)), period(period) {}
+
+      std::function<void()> function;
+      /// period in ticks, zero for one-shot tasks
+      const size_t period;
+      /// revolutions of the wheel left before the task expires
+      size_t rounds{0};
+      std::atomic<bool> cancelled{false};
+    };
+
+    // ------|TimerHandle|------
+
+    TimerHandle::TimerHandle(std::shared_ptr<Task> task)
+        : task_(std::move(task)) {}
+
+    void TimerHandle::cancel() const {
+      if (task_) {
+        task_->cancelled = true;
+      }
+    }
+
+    bool TimerHandle::done() const {
+      return not task_ or task_->cancelled;
+    }
+
+    // ------|TimerWheel|------
+
+    TimerWheel::TimerWheel(std::chrono::milliseconds resolution, size_t slots)
+        : resolution_(std::max(resolution, std::chrono::milliseconds(1))),
+          slots_(std::max(slots, size_t(1))) {}
+
+    TimerWheel::~TimerWheel() {
+      stop();
+    }
+
+    TimerHandle TimerWheel::schedule(std::chrono::milliseconds delay,
+                                     std::function<void()> task) {
+      auto entry = std::make_shared<TimerHandle::Task>(std::move(task), 0);
+      insert(entry, toTicks(delay));
+      return TimerHandle(std::move(entry));
+    }
+
+    TimerHandle TimerWheel::schedulePeriodic(std::chrono::milliseconds period,
+                                             std::function<void()> task) {
+      auto ticks = toTicks(period);
+      auto entry = std::make_shared<TimerHandle::Task>(std::move(task), ticks);
+      insert(entry, ticks);
+      return TimerHandle(std::move(entry));
+    }
+
+    void TimerWheel::tick() {
+      std::vector<std::shared_ptr<TimerHandle::Task>> expired;
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        cursor_ = (cursor_ + 1) % slots_.size();
+        auto &slot = slots_[cursor_];
+        auto pending = std::partition(
+            slot.begin(), slot.end(), [](const auto &task) {
+              return not task->cancelled and task->rounds > 0;
+            });
+        std::for_each(
+            slot.begin(), pending, [](const auto &task) { --task->rounds; });
+        std::copy_if(std::make_move_iterator(pending),
+                     std::make_move_iterator(slot.end()),
+                     std::back_inserter(expired),
+                     [](const auto &task) { return not task->cancelled; });
+        slot.erase(pending, slot.end());
+      }
+
+      // tasks are invoked without the lock, so they may schedule new ones
+      for (auto &task : expired) {
+        // task may be cancelled after it was taken from the slot
+        if (task->cancelled) {
+          continue;
+        }
+        task->function();
+        if (task->period == 0) {
+          task->cancelled = true;
+        } else if (not task->cancelled) {
+          insert(task, task->period);
+        }
+      }
+    }
+
+    void TimerWheel::start() {
+      std::lock_guard<std::mutex> lock(thread_mutex_);
+      if (running_) {
+        return;
+      }
+      running_ = true;
+      thread_ = std::thread([this] { this->run(); });
+    }
+
+    void TimerWheel::stop() {
+      {
+        std::lock_guard<std::mutex> lock(thread_mutex_);
+        running_ = false;
+      }
+      stop_condition_.notify_all();
+      if (thread_.joinable()) {
+        thread_.join();
+      }
+    }
+
+    size_t TimerWheel::toTicks(std::chrono::milliseconds delay) const {
+      auto ticks = (delay.count() + resolution_.count() - 1)
+          / resolution_.count();
+      return std::max<size_t>(ticks, 1);
+    }
+
+    void TimerWheel::insert(std::shared_ptr<TimerHandle::Task> task,
+                            size_t ticks) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      task->rounds = (ticks - 1) / slots_.size();
+      slots_[(cursor_ + ticks) % slots_.size()].push_back(std::move(task));
+    }
+
+    void TimerWheel::run() {
+      // deadlines are computed from the start, so time spent in tasks does
+      // not accumulate as a drift
+      auto deadline = Clock::now() + resolution_;
+      std::unique_lock<std::mutex> lock(thread_mutex_);
+      while (running_) {
+        if (stop_condition_.wait_until(
+                lock, deadline, [this] { return not running_; })) {
+          break;
+        }
+        lock.unlock();
+        tick();
+        lock.lock();
+        deadline += resolution_;
+      }
+    }
+
+  }  // namespace timer
+}  // namespace iroha
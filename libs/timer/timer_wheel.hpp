@@ -0,0 +1,131 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_TIMER_WHEEL_HPP
+#define IROHA_TIMER_WHEEL_HPP
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace iroha {
+  namespace timer {
+
+    class TimerWheel;
+
+    /**
+     * Handle of a scheduled task. Copies refer to the same task.
+     * Default constructed handle refers to no task.
+     */
+    class TimerHandle {
+     public:
+      TimerHandle() = default;
+
+      /**
+       * Prevent further invocations of the task. Task which is being
+       * invoked at the moment finishes normally
+       */
+      void cancel() const;
+
+      /**
+       * @return true if the task is cancelled or a one-shot task is invoked
+       */
+      bool done() const;
+
+     private:
+      friend class TimerWheel;
+
+      struct Task;
+
+      explicit TimerHandle(std::shared_ptr<Task> task);
+
+      std::shared_ptr<Task> task_;
+    };
+
+    /**
+     * Hashed timing wheel which invokes tasks with resolution of one tick.
+     * Schedule and cancel take constant time, each tick processes tasks of
+     * a single slot only.
+     * Tasks are invoked sequentially on the thread of the wheel, so they
+     * should be short and hand off long work to other threads.
+     * Wheel may be driven manually with tick() instead of start()
+     */
+    class TimerWheel {
+     public:
+      using Clock = std::chrono::steady_clock;
+
+      /**
+       * @param resolution - duration of one tick
+       * @param slots - number of slots, delays longer than
+       * resolution * slots take several revolutions of the wheel
+       */
+      explicit TimerWheel(std::chrono::milliseconds resolution,
+                          size_t slots = 512);
+
+      TimerWheel(const TimerWheel &) = delete;
+      TimerWheel &operator=(const TimerWheel &) = delete;
+
+      ~TimerWheel();
+
+      /**
+       * Invoke task once after delay with precision of one tick
+       * @return handle to cancel the task
+       */
+      TimerHandle schedule(std::chrono::milliseconds delay,
+                           std::function<void()> task);
+
+      /**
+       * Invoke task every period with precision of one tick until it is
+       * cancelled
+       * @return handle to cancel the task
+       */
+      TimerHandle schedulePeriodic(std::chrono::milliseconds period,
+                                   std::function<void()> task);
+
+      /**
+       * Advance the wheel by one tick and invoke expired tasks
+       */
+      void tick();
+
+      /**
+       * Start a thread which ticks the wheel every resolution
+       */
+      void start();
+
+      /**
+       * Stop and join the thread of the wheel. Scheduled tasks are kept
+       */
+      void stop();
+
+     private:
+      size_t toTicks(std::chrono::milliseconds delay) const;
+
+      /**
+       * Put task to the slot of given number of ticks from the current one
+       */
+      void insert(std::shared_ptr<TimerHandle::Task> task, size_t ticks);
+
+      void run();
+
+      const std::chrono::milliseconds resolution_;
+      std::vector<std::vector<std::shared_ptr<TimerHandle::Task>>> slots_;
+      size_t cursor_{0};
+      std::mutex mutex_;
+
+      std::thread thread_;
+      std::mutex thread_mutex_;
+      std::condition_variable stop_condition_;
+      bool running_{false};
+    };
+
+  }  // namespace timer
+}  // namespace iroha
+
+#endif  // IROHA_TIMER_WHEEL_HPP
@@ -8,6 +8,7 @@
 #include "interfaces/transaction_responses/committed_tx_response.hpp"
 #include "interfaces/transaction_responses/mst_expired_response.hpp"
 #include "interfaces/transaction_responses/not_received_tx_response.hpp"
+#include "interfaces/transaction_responses/overloaded_tx_response.hpp"
 #include "interfaces/transaction_responses/stateful_failed_tx_response.hpp"
 #include "interfaces/transaction_responses/stateful_valid_tx_response.hpp"
 #include "interfaces/transaction_responses/stateless_failed_tx_response.hpp"
@@ -34,5 +35,7 @@ namespace shared_model {
                                             iroha::protocol::ToriiResponse>;
     using NotReceivedTxResponse = TrivialProto<interface::NotReceivedTxResponse,
                                                iroha::protocol::ToriiResponse>;
+    using OverloadedTxResponse = TrivialProto<interface::OverloadedTxResponse,
+                                              iroha::protocol::ToriiResponse>;
   }  // namespace proto
 }  // namespace shared_model
@@ -18,10 +18,12 @@
 #ifndef IROHA_AMOUNT_BUILDER_HPP
 #define IROHA_AMOUNT_BUILDER_HPP
 
-#include <regex>
+#include <algorithm>
+#include <memory>
 
 #include "builders/common_objects/common.hpp"
 #include "interfaces/common_objects/amount.hpp"
+#include "validators/field_scanners.hpp"
 
 // TODO: 14.02.2018 nickaleks Add check for uninitialized fields IR-972
 
@@ -64,8 +66,7 @@ namespace shared_model {
           std::string str_amount) {
         // taken from iroha::model::Amount
         // check if valid number
-        std::regex e("([0-9]*\\.[0-9]+|[0-9]+)");
-        if (!std::regex_match(str_amount, e)) {
+        if (not validation::scanners::isAmount(str_amount)) {
           return iroha::expected::makeError(
               std::make_shared<std::string>("number string is invalid"));
         }
@@ -65,58 +65,89 @@ namespace shared_model {
       TemplateBlockBuilder(const TemplateBlockBuilder<Sp, SVp, BTp> &o)
           : block_(o.block_), stateless_validator_(o.stateless_validator_) {}
 
+      template <int Sp, typename SVp, typename BTp>
+      TemplateBlockBuilder(TemplateBlockBuilder<Sp, SVp, BTp> &&o)
+          : block_(std::move(o.block_)),
+            stateless_validator_(std::move(o.stateless_validator_)) {}
+
       /**
-       * Make transformation on copied content
-       * @tparam Transformation - callable type for changing the copy
+       * Make transformation on moved content
+       * @tparam Transformation - callable type for changing the content
        * @param t - transform function for proto object
        * @return new builder with updated state
        */
       template <int Fields, typename Transformation>
-      auto transform(Transformation t) const {
-        NextBuilder<Fields> copy = *this;
-        t(copy.block_);
-        return copy;
+      auto transform(Transformation t) && {
+        NextBuilder<Fields> next = std::move(*this);
+        t(next.block_);
+        return next;
       }
 
      public:
       TemplateBlockBuilder(const SV &validator = SV())
           : stateless_validator_(validator){};
 
+      // IR-1046: setters and build of a temporary builder move transactions
+      // collected so far, the ones of an lvalue builder copy them
+
       template <class T>
-      auto transactions(const T &transactions) const {
-        return transform<Transactions>([&](auto &block) {
-          for (const auto &tx : transactions) {
-            new (block.mutable_payload()->add_transactions())
-                iroha::protocol::Transaction(tx.getTransport());
-          }
-        });
+      auto transactions(const T &transactions) const & {
+        return TemplateBlockBuilder(*this).transactions(transactions);
+      }
+
+      template <class T>
+      auto transactions(const T &transactions) && {
+        return std::move(*this).template transform<Transactions>(
+            [&](auto &block) {
+              for (const auto &tx : transactions) {
+                new (block.mutable_payload()->add_transactions())
+                    iroha::protocol::Transaction(tx.getTransport());
+              }
+            });
+      }
+
+      auto height(interface::types::HeightType height) const & {
+        return TemplateBlockBuilder(*this).height(height);
       }
 
-      auto height(interface::types::HeightType height) const {
-        return transform<Height>(
+      auto height(interface::types::HeightType height) && {
+        return std::move(*this).template transform<Height>(
             [&](auto &block) { block.mutable_payload()->set_height(height); });
       }
 
-      auto prevHash(crypto::Hash hash) const {
-        return transform<PrevHash>([&](auto &block) {
+      auto prevHash(crypto::Hash hash) const & {
+        return TemplateBlockBuilder(*this).prevHash(std::move(hash));
+      }
+
+      auto prevHash(crypto::Hash hash) && {
+        return std::move(*this).template transform<PrevHash>([&](auto &block) {
           block.mutable_payload()->set_prev_block_hash(
               crypto::toBinaryString(hash));
         });
       }
 
-      auto createdTime(interface::types::TimestampType time) const {
-        return transform<CreatedTime>([&](auto &block) {
-          block.mutable_payload()->set_created_time(time);
-        });
+      auto createdTime(interface::types::TimestampType time) const & {
+        return TemplateBlockBuilder(*this).createdTime(time);
+      }
+
+      auto createdTime(interface::types::TimestampType time) && {
+        return std::move(*this).template transform<CreatedTime>(
+            [&](auto &block) {
+              block.mutable_payload()->set_created_time(time);
+            });
+      }
+
+      BT build() & {
+        return TemplateBlockBuilder(*this).build();
       }
 
-      BT build() {
+      BT build() && {
         static_assert(S == (1 << TOTAL) - 1, "Required fields are not set");
 
         auto tx_number = block_.payload().transactions().size();
         block_.mutable_payload()->set_tx_number(tx_number);
 
-        auto result = Block(iroha::protocol::Block(block_));
+        auto result = Block(std::move(block_));
         auto answer = stateless_validator_.validate(result);
 
         if (answer.hasErrors()) {
@@ -52,47 +52,73 @@ namespace shared_model {
           : proposal_(o.proposal_),
             stateless_validator_(o.stateless_validator_) {}
 
+      template <int Sp>
+      TemplateProposalBuilder(TemplateProposalBuilder<Sp, SV> &&o)
+          : proposal_(std::move(o.proposal_)),
+            stateless_validator_(std::move(o.stateless_validator_)) {}
+
       /**
-       * Make transformation on copied content
-       * @tparam Transformation - callable type for changing the copy
+       * Make transformation on moved content
+       * @tparam Transformation - callable type for changing the content
        * @param t - transform function for proto object
        * @return new builder with updated state
        */
       template <int Fields, typename Transformation>
-      auto transform(Transformation t) const {
-        NextBuilder<Fields> copy = *this;
-        t(copy.proposal_);
-        return copy;
+      auto transform(Transformation t) && {
+        NextBuilder<Fields> next = std::move(*this);
+        t(next.proposal_);
+        return next;
       }
 
      public:
       TemplateProposalBuilder(const SV &validator = SV())
           : stateless_validator_(validator){};
 
-      auto height(const interface::types::HeightType height) const {
-        return transform<Height>(
+      // IR-1046: setters and build of a temporary builder move transactions
+      // collected so far, the ones of an lvalue builder copy them
+
+      auto height(const interface::types::HeightType height) const & {
+        return TemplateProposalBuilder(*this).height(height);
+      }
+
+      auto height(const interface::types::HeightType height) && {
+        return std::move(*this).template transform<Height>(
             [&](auto &proposal) { proposal.set_height(height); });
       }
 
       template <class T>
-      auto transactions(const T &transactions) const {
-        return transform<Transactions>([&](auto &proposal) {
-          for (const auto &tx : transactions) {
-            new (proposal.add_transactions())
-                iroha::protocol::Transaction(tx.getTransport());
-          }
-        });
+      auto transactions(const T &transactions) const & {
+        return TemplateProposalBuilder(*this).transactions(transactions);
+      }
+
+      template <class T>
+      auto transactions(const T &transactions) && {
+        return std::move(*this).template transform<Transactions>(
+            [&](auto &proposal) {
+              for (const auto &tx : transactions) {
+                new (proposal.add_transactions())
+                    iroha::protocol::Transaction(tx.getTransport());
+              }
+            });
       }
 
       auto createdTime(
-          const interface::types::TimestampType created_time) const {
-        return transform<CreatedTime>(
+          const interface::types::TimestampType created_time) const & {
+        return TemplateProposalBuilder(*this).createdTime(created_time);
+      }
+
+      auto createdTime(const interface::types::TimestampType created_time) && {
+        return std::move(*this).template transform<CreatedTime>(
             [&](auto &proposal) { proposal.set_created_time(created_time); });
       }
 
-      Proposal build() {
+      Proposal build() & {
+        return TemplateProposalBuilder(*this).build();
+      }
+
+      Proposal build() && {
         static_assert(S == (1 << TOTAL) - 1, "Required fields are not set");
-        auto result = Proposal(iroha::protocol::Proposal(proposal_));
+        auto result = Proposal(std::move(proposal_));
         auto answer = stateless_validator_.validate(result);
         if (answer.hasErrors()) {
           throw std::invalid_argument(answer.reason());
@@ -42,6 +42,8 @@ namespace shared_model {
 
       TransactionStatusBuilder mstExpired();
 
+      TransactionStatusBuilder overloaded();
+
       TransactionStatusBuilder txHash(const crypto::Hash &hash);
 
      private:
@@ -18,6 +18,8 @@
 #ifndef IROHA_CRYPTO_VERIFIER_HPP
 #define IROHA_CRYPTO_VERIFIER_HPP
 
+#include <vector>
+
 #include "cryptography/crypto_provider/crypto_defaults.hpp"
 
 namespace shared_model {
@@ -48,6 +50,16 @@ namespace shared_model {
         return Algorithm::verify(signedData, source, pubKey);
       }
 
+      /**
+       * Verify several signatures at once
+       * @param messages - signatures with source data and public keys
+       * @return indices of invalid signatures, empty if all are correct
+       */
+      static std::vector<size_t> verifyBatch(
+          const std::vector<typename Algorithm::SignedMessage> &messages) {
+        return Algorithm::verifyBatch(messages);
+      }
+
       /// close constructor for forbidding instantiation
       CryptoVerifier() = delete;
     };
@@ -34,6 +34,11 @@ namespace shared_model {
       return Verifier::verify(signedData, orig, publicKey);
     }
 
+    std::vector<size_t> CryptoProviderEd25519Sha3::verifyBatch(
+        const std::vector<SignedMessage> &messages) {
+      return Verifier::verifyBatch(messages);
+    }
+
     Seed CryptoProviderEd25519Sha3::generateSeed() {
       return Seed(iroha::create_seed().to_string());
     }
@@ -18,6 +18,7 @@
 #ifndef IROHA_CRYPTOPROVIDER_HPP
 #define IROHA_CRYPTOPROVIDER_HPP
 
+#include "cryptography/ed25519_sha3_impl/verifier.hpp"
 #include "cryptography/keypair.hpp"
 #include "cryptography/seed.hpp"
 #include "cryptography/signed.hpp"
@@ -47,6 +48,17 @@ namespace shared_model {
       static bool verify(const Signed &signedData,
                          const Blob &orig,
                          const PublicKey &publicKey);
+
+      using SignedMessage = Verifier::SignedMessage;
+
+      /**
+       * Verifies several signatures at once.
+       * @param messages - signatures with original messages and public keys
+       * @return indices of invalid signatures, empty if all of them are valid
+       */
+      static std::vector<size_t> verifyBatch(
+          const std::vector<SignedMessage> &messages);
+
       /**
        * Generates new seed
        * @return Seed generated
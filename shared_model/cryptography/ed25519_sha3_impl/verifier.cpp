@@ -29,5 +29,31 @@ namespace shared_model {
           iroha::pubkey_t::from_string(toBinaryString(publicKey)),
           iroha::sig_t::from_string(toBinaryString(signedData)));
     }
+
+    std::vector<size_t> Verifier::verifyBatch(
+        const std::vector<SignedMessage> &messages) {
+      std::vector<size_t> invalid;
+      const Blob *digest_source = nullptr;
+      std::string digest;
+      for (size_t i = 0; i < messages.size(); ++i) {
+        const auto &message = messages[i];
+        if (digest_source == nullptr
+            or (digest_source != &message.orig
+                and not(*digest_source == message.orig))) {
+          digest = iroha::sha3_256(crypto::toBinaryString(message.orig))
+                       .to_string();
+          digest_source = &message.orig;
+        }
+        if (not iroha::verify(
+                digest,
+                iroha::pubkey_t::from_string(
+                    toBinaryString(message.public_key)),
+                iroha::sig_t::from_string(
+                    toBinaryString(message.signed_data)))) {
+          invalid.push_back(i);
+        }
+      }
+      return invalid;
+    }
   }  // namespace crypto
 }  // namespace shared_model
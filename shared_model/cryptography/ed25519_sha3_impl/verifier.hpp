@@ -18,6 +18,8 @@
 #ifndef IROHA_SHARED_MODEL_VERIFIER_HPP
 #define IROHA_SHARED_MODEL_VERIFIER_HPP
 
+#include <vector>
+
 #include "cryptography/public_key.hpp"
 #include "cryptography/signed.hpp"
 
@@ -28,9 +30,27 @@ namespace shared_model {
      */
     class Verifier {
      public:
+      /**
+       * Signature with original message and public key of signatory
+       */
+      struct SignedMessage {
+        const Signed &signed_data;
+        const Blob &orig;
+        const PublicKey &public_key;
+      };
+
       static bool verify(const Signed &signedData,
                          const Blob &orig,
                          const PublicKey &publicKey);
+
+      /**
+       * Verify several signatures. Digest of a message is computed once for
+       * consecutive signatures of the same message.
+       * @param messages - signatures to verify
+       * @return indices of invalid signatures, empty if all are valid
+       */
+      static std::vector<size_t> verifyBatch(
+          const std::vector<SignedMessage> &messages);
     };
 
   }  // namespace crypto
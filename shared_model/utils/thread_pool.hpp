@@ -0,0 +1,164 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_SHARED_MODEL_THREAD_POOL_HPP
+#define IROHA_SHARED_MODEL_THREAD_POOL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace shared_model {
+  namespace detail {
+
+    /**
+     * Fixed set of threads which help callers of parallelFor to process
+     * their indices. Callers take part in the processing as well, so the pool
+     * is never required for progress
+     */
+    class ThreadPool {
+     public:
+      /**
+       * @param threads - number of threads in the pool
+       */
+      explicit ThreadPool(size_t threads) {
+        for (size_t i = 0; i < threads; ++i) {
+          threads_.emplace_back([this] { work(); });
+        }
+      }
+
+      ThreadPool(const ThreadPool &) = delete;
+      ThreadPool &operator=(const ThreadPool &) = delete;
+
+      ~ThreadPool() {
+        {
+          std::lock_guard<std::mutex> lock(mutex_);
+          stopped_ = true;
+        }
+        condition_.notify_all();
+        for (auto &thread : threads_) {
+          thread.join();
+        }
+      }
+
+      /**
+       * @return pool shared by the whole process, with a thread for every
+       * hardware core except the one of the caller
+       */
+      static ThreadPool &instance() {
+        static ThreadPool pool(
+            std::max(std::thread::hardware_concurrency(), 2u) - 1);
+        return pool;
+      }
+
+      /**
+       * Call function for every index in [0, count) and wait for all calls.
+       * Calls are made concurrently in unspecified order, calls made from a
+       * thread of the pool are executed serially
+       * @param count - number of indices
+       * @param function - callable with index argument
+       */
+      template <typename Function>
+      void parallelFor(size_t count, Function &&function) {
+        if (isPoolThread() or threads_.empty() or count < 2) {
+          for (size_t i = 0; i < count; ++i) {
+            function(i);
+          }
+          return;
+        }
+
+        struct State {
+          std::atomic<size_t> next{0};
+          size_t helpers = 0;
+          std::exception_ptr error;
+          std::mutex mutex;
+          std::condition_variable finished;
+        };
+        auto state = std::make_shared<State>();
+        // several chunks per thread balance the load when calls take
+        // different time
+        const size_t chunk =
+            std::max<size_t>(count / ((threads_.size() + 1) * 4), 1);
+        auto process = [state, count, chunk, &function] {
+          try {
+            for (auto begin = state->next.fetch_add(chunk); begin < count;
+                 begin = state->next.fetch_add(chunk)) {
+              for (auto i = begin; i < std::min(begin + chunk, count); ++i) {
+                function(i);
+              }
+            }
+          } catch (...) {
+            std::lock_guard<std::mutex> lock(state->mutex);
+            state->error = std::current_exception();
+            state->next = count;
+          }
+        };
+
+        state->helpers = std::min(threads_.size(), (count - 1) / chunk);
+        {
+          std::lock_guard<std::mutex> lock(mutex_);
+          for (size_t i = 0; i < state->helpers; ++i) {
+            tasks_.emplace_back([state, process] {
+              process();
+              std::lock_guard<std::mutex> lock(state->mutex);
+              if (--state->helpers == 0) {
+                state->finished.notify_one();
+              }
+            });
+          }
+        }
+        condition_.notify_all();
+
+        process();
+        std::unique_lock<std::mutex> lock(state->mutex);
+        // helpers refer to the function, so they must finish before return
+        state->finished.wait(lock, [&state] { return state->helpers == 0; });
+        if (state->error) {
+          std::rethrow_exception(state->error);
+        }
+      }
+
+     private:
+      static bool &isPoolThread() {
+        static thread_local bool pool_thread = false;
+        return pool_thread;
+      }
+
+      void work() {
+        isPoolThread() = true;
+        while (true) {
+          std::function<void()> task;
+          {
+            std::unique_lock<std::mutex> lock(mutex_);
+            condition_.wait(lock,
+                            [this] { return stopped_ or not tasks_.empty(); });
+            if (tasks_.empty()) {
+              return;
+            }
+            task = std::move(tasks_.front());
+            tasks_.pop_front();
+          }
+          task();
+        }
+      }
+
+      std::mutex mutex_;
+      std::condition_variable condition_;
+      std::deque<std::function<void()>> tasks_;
+      bool stopped_ = false;
+      std::vector<std::thread> threads_;
+    };
+
+  }  // namespace detail
+}  // namespace shared_model
+
+#endif  // IROHA_SHARED_MODEL_THREAD_POOL_HPP
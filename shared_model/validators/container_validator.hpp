@@ -18,10 +18,14 @@
 #ifndef IROHA_CONTAINER_VALIDATOR_HPP
 #define IROHA_CONTAINER_VALIDATOR_HPP
 
+#include <iterator>
+#include <vector>
+
 #include <boost/format.hpp>
 #include "datetime/time.hpp"
 #include "interfaces/common_objects/types.hpp"
 #include "interfaces/iroha_internal/block.hpp"
+#include "utils/thread_pool.hpp"
 #include "validators/answer.hpp"
 
 // TODO 22/01/2018 x3medima17: write stateless validator IR-837
@@ -36,6 +40,10 @@ namespace shared_model {
               typename FieldValidator,
               typename TransactionValidator>
     class ContainerValidator {
+     public:
+      /// number of transactions from which they are validated concurrently
+      static constexpr size_t kParallelValidationThreshold = 64;
+
      protected:
       void validateTransaction(
           ReasonsGroupType &reason,
@@ -50,8 +58,32 @@ namespace shared_model {
           ReasonsGroupType &reason,
           const interface::types::TransactionsCollectionType &transactions)
           const {
+        if (transactions.size() < kParallelValidationThreshold) {
+          for (const auto &tx : transactions) {
+            validateTransaction(reason, tx);
+          }
+          return;
+        }
+
+        // transactions are collected in this thread, since collection of
+        // the container can be initialized lazily
+        std::vector<const interface::Transaction *> txs;
+        txs.reserve(transactions.size());
         for (const auto &tx : transactions) {
-          validateTransaction(reason, tx);
+          txs.push_back(&tx);
+        }
+        std::vector<ReasonsGroupType> tx_reasons(txs.size());
+        detail::ThreadPool::instance().parallelFor(
+            txs.size(),
+            [this, &txs, &tx_reasons](size_t i) {
+              validateTransaction(tx_reasons[i], *txs[i]);
+            });
+        // reasons are merged in order of transactions, so the answer is the
+        // same as of serial validation
+        for (auto &tx_reason : tx_reasons) {
+          std::move(tx_reason.second.begin(),
+                    tx_reason.second.end(),
+                    std::back_inserter(reason.second));
         }
       }
 
@@ -82,6 +114,14 @@ namespace shared_model {
       FieldValidator field_validator_;
     };
 
+    template <typename Iface,
+              typename FieldValidator,
+              typename TransactionValidator>
+    constexpr size_t ContainerValidator<
+        Iface,
+        FieldValidator,
+        TransactionValidator>::kParallelValidationThreshold;
+
   }  // namespace validation
 }  // namespace shared_model
 
@@ -0,0 +1,192 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_SHARED_MODEL_FIELD_SCANNERS_HPP
+#define IROHA_SHARED_MODEL_FIELD_SCANNERS_HPP
+
+#include <string>
+
+namespace shared_model {
+  namespace validation {
+    /**
+     * Hand-written recognizers of the field formats. Every function accepts
+     * exactly the language of the regular expression in its description, and
+     * neither allocates nor backtracks
+     */
+    namespace scanners {
+
+      inline bool isDigit(char c) {
+        return c >= '0' and c <= '9';
+      }
+
+      inline bool isLower(char c) {
+        return c >= 'a' and c <= 'z';
+      }
+
+      inline bool isLetter(char c) {
+        return isLower(c) or (c >= 'A' and c <= 'Z');
+      }
+
+      inline bool isAlnum(char c) {
+        return isLetter(c) or isDigit(c);
+      }
+
+      /**
+       * @return true if [begin, end) is a decimal number within [0, max]
+       * without leading zeros
+       */
+      inline bool isNumber(const char *begin, const char *end, unsigned max) {
+        if (begin == end or end - begin > 5
+            or (*begin == '0' and end - begin > 1)) {
+          return false;
+        }
+        unsigned value = 0;
+        for (auto it = begin; it != end; ++it) {
+          if (not isDigit(*it)) {
+            return false;
+          }
+          value = value * 10 + (*it - '0');
+        }
+        return value <= max;
+      }
+
+      /// [a-z_0-9]{1,32} in [begin, end)
+      inline bool isName(const char *begin, const char *end) {
+        if (begin == end or end - begin > 32) {
+          return false;
+        }
+        for (auto it = begin; it != end; ++it) {
+          if (not(isLower(*it) or isDigit(*it) or *it == '_')) {
+            return false;
+          }
+        }
+        return true;
+      }
+
+      /// [a-zA-Z]([a-zA-Z0-9\-]{0,61}[a-zA-Z0-9])? in [begin, end)
+      inline bool isDomainLabel(const char *begin, const char *end) {
+        if (begin == end or end - begin > 63 or not isLetter(*begin)
+            or not isAlnum(*(end - 1))) {
+          return false;
+        }
+        for (auto it = begin + 1; it != end; ++it) {
+          if (not(isAlnum(*it) or *it == '-')) {
+            return false;
+          }
+        }
+        return true;
+      }
+
+      /// (label\.)*label in [begin, end), where label is a domain label
+      inline bool isDomain(const char *begin, const char *end) {
+        auto label = begin;
+        for (auto it = begin; it != end; ++it) {
+          if (*it == '.') {
+            if (not isDomainLabel(label, it)) {
+              return false;
+            }
+            label = it + 1;
+          }
+        }
+        return isDomainLabel(label, end);
+      }
+
+      /// name<separator>domain in [begin, end)
+      inline bool isNameInDomain(const char *begin,
+                                 const char *end,
+                                 char separator) {
+        // neither name nor domain contain the separator
+        for (auto it = begin; it != end; ++it) {
+          if (*it == separator) {
+            return isName(begin, it) and isDomain(it + 1, end);
+          }
+        }
+        return false;
+      }
+
+      /// (octet\.){3}octet in [begin, end), where octet is within [0, 255]
+      inline bool isIpV4(const char *begin, const char *end) {
+        auto octet = begin;
+        size_t dots = 0;
+        for (auto it = begin; it != end; ++it) {
+          if (*it == '.') {
+            if (++dots > 3 or not isNumber(octet, it, 255)) {
+              return false;
+            }
+            octet = it + 1;
+          }
+        }
+        return dots == 3 and isNumber(octet, end, 255);
+      }
+
+      /// [a-z_0-9]{1,32}
+      inline bool isName(const std::string &value) {
+        return isName(value.data(), value.data() + value.size());
+      }
+
+      /// [A-Za-z0-9_]{1,64}
+      inline bool isDetailKey(const std::string &value) {
+        if (value.empty() or value.size() > 64) {
+          return false;
+        }
+        for (auto c : value) {
+          if (not(isAlnum(c) or c == '_')) {
+            return false;
+          }
+        }
+        return true;
+      }
+
+      /// ([a-zA-Z]([a-zA-Z0-9\-]{0,61}[a-zA-Z0-9])?\.)*
+      /// [a-zA-Z]([a-zA-Z0-9\-]{0,61}[a-zA-Z0-9])?
+      inline bool isDomain(const std::string &value) {
+        return isDomain(value.data(), value.data() + value.size());
+      }
+
+      /// name\@domain
+      inline bool isAccountId(const std::string &value) {
+        return isNameInDomain(value.data(), value.data() + value.size(), '@');
+      }
+
+      /// name\#domain
+      inline bool isAssetId(const std::string &value) {
+        return isNameInDomain(value.data(), value.data() + value.size(), '#');
+      }
+
+      /// (ipv4|domain):port, where port is within [0, 65535]
+      inline bool isPeerAddress(const std::string &value) {
+        auto begin = value.data(), end = value.data() + value.size();
+        // neither host nor port contain a colon
+        for (auto it = begin; it != end; ++it) {
+          if (*it == ':') {
+            return (isIpV4(begin, it) or isDomain(begin, it))
+                and isNumber(it + 1, end, 65535);
+          }
+        }
+        return false;
+      }
+
+      /// [0-9]*\.[0-9]+|[0-9]+
+      inline bool isAmount(const std::string &value) {
+        auto dot = value.find('.');
+        auto digits = [&value](size_t begin, size_t end) {
+          for (auto i = begin; i < end; ++i) {
+            if (not isDigit(value[i])) {
+              return false;
+            }
+          }
+          return begin < end;
+        };
+        if (dot == std::string::npos) {
+          return digits(0, value.size());
+        }
+        return (dot == 0 or digits(0, dot)) and digits(dot + 1, value.size());
+      }
+
+    }  // namespace scanners
+  }  // namespace validation
+}  // namespace shared_model
+
+#endif  // IROHA_SHARED_MODEL_FIELD_SCANNERS_HPP
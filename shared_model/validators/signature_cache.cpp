@@ -0,0 +1,101 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "validators/signature_cache.hpp"
+
+#include <algorithm>
+#include <functional>
+
+namespace shared_model {
+  namespace validation {
+
+    const size_t SignatureCache::kDefaultCapacity = 1 << 16;
+
+    constexpr size_t SignatureCache::kShards;
+
+    SignatureCache::SignatureCache(size_t capacity)
+        : shard_capacity_(std::max<size_t>(capacity / kShards, 1)) {}
+
+    SignatureCache &SignatureCache::instance() {
+      static SignatureCache cache;
+      return cache;
+    }
+
+    bool SignatureCache::contains(const crypto::Hash &payload_hash,
+                                  const crypto::PublicKey &public_key,
+                                  const crypto::Signed &signed_data) {
+      auto key = makeKey(payload_hash, public_key, signed_data);
+      auto &key_shard = shard(key);
+      bool found;
+      {
+        std::lock_guard<std::mutex> lock(key_shard.mutex);
+        found = key_shard.keys.count(key) != 0;
+      }
+      ++(found ? hits_ : misses_);
+      return found;
+    }
+
+    void SignatureCache::insert(const crypto::Hash &payload_hash,
+                                const crypto::PublicKey &public_key,
+                                const crypto::Signed &signed_data) {
+      auto key = makeKey(payload_hash, public_key, signed_data);
+      auto &key_shard = shard(key);
+      std::lock_guard<std::mutex> lock(key_shard.mutex);
+      auto inserted = key_shard.keys.insert(std::move(key));
+      if (not inserted.second) {
+        return;
+      }
+      // pointers to elements stay valid on rehashing
+      key_shard.order.push_back(&*inserted.first);
+      if (key_shard.order.size() > shard_capacity_) {
+        key_shard.keys.erase(key_shard.keys.find(*key_shard.order.front()));
+        key_shard.order.pop_front();
+      }
+    }
+
+    size_t SignatureCache::size() const {
+      size_t result = 0;
+      for (const auto &key_shard : shards_) {
+        std::lock_guard<std::mutex> lock(key_shard.mutex);
+        result += key_shard.keys.size();
+      }
+      return result;
+    }
+
+    size_t SignatureCache::hits() const {
+      return hits_;
+    }
+
+    size_t SignatureCache::misses() const {
+      return misses_;
+    }
+
+    double SignatureCache::hitRate() const {
+      auto hits = hits_.load();
+      auto lookups = hits + misses_.load();
+      return lookups == 0 ? 0. : static_cast<double>(hits) / lookups;
+    }
+
+    std::string SignatureCache::makeKey(const crypto::Hash &payload_hash,
+                                        const crypto::PublicKey &public_key,
+                                        const crypto::Signed &signed_data) {
+      std::string key;
+      key.reserve(payload_hash.size() + public_key.size()
+                  + signed_data.size());
+      auto append = [&key](const crypto::Blob &blob) {
+        key.append(blob.blob().begin(), blob.blob().end());
+      };
+      append(payload_hash);
+      append(public_key);
+      append(signed_data);
+      return key;
+    }
+
+    SignatureCache::Shard &SignatureCache::shard(const std::string &key) {
+      return shards_[std::hash<std::string>{}(key) % kShards];
+    }
+
+  }  // namespace validation
+}  // namespace shared_model
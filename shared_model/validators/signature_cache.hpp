@@ -0,0 +1,114 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_SHARED_MODEL_SIGNATURE_CACHE_HPP
+#define IROHA_SHARED_MODEL_SIGNATURE_CACHE_HPP
+
+#include <array>
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+
+#include "cryptography/hash.hpp"
+#include "cryptography/public_key.hpp"
+#include "cryptography/signed.hpp"
+
+namespace shared_model {
+  namespace validation {
+
+    /**
+     * Bounded set of successfully verified signatures, which can be used
+     * concurrently. A signature is identified by hash of signed payload,
+     * public key and signature itself, so a hit means that exactly the same
+     * verification has already succeeded. When the cache is full, the
+     * oldest signatures are forgotten
+     */
+    class SignatureCache {
+     public:
+      /// number of signatures remembered by default
+      static const size_t kDefaultCapacity;
+
+      /**
+       * @param capacity - maximal number of remembered signatures
+       */
+      explicit SignatureCache(size_t capacity = kDefaultCapacity);
+
+      /**
+       * @return cache shared by all validators of the process
+       */
+      static SignatureCache &instance();
+
+      /**
+       * Check whether the signature has been verified, the result is
+       * counted as hit or miss
+       * @param payload_hash - hash of signed payload
+       * @param public_key - public key of the signature
+       * @param signed_data - signature
+       * @return true if the signature is remembered
+       */
+      bool contains(const crypto::Hash &payload_hash,
+                    const crypto::PublicKey &public_key,
+                    const crypto::Signed &signed_data);
+
+      /**
+       * Remember successfully verified signature
+       * @param payload_hash - hash of signed payload
+       * @param public_key - public key of the signature
+       * @param signed_data - signature
+       */
+      void insert(const crypto::Hash &payload_hash,
+                  const crypto::PublicKey &public_key,
+                  const crypto::Signed &signed_data);
+
+      /**
+       * @return number of remembered signatures
+       */
+      size_t size() const;
+
+      /**
+       * @return number of lookups which found the signature
+       */
+      size_t hits() const;
+
+      /**
+       * @return number of lookups which did not find the signature
+       */
+      size_t misses() const;
+
+      /**
+       * @return share of lookups which found the signature, 0 if there were
+       * no lookups
+       */
+      double hitRate() const;
+
+     private:
+      /// signatures of a shard are guarded by its own mutex
+      struct Shard {
+        mutable std::mutex mutex;
+        std::unordered_set<std::string> keys;
+        /// keys in order of insertion, for eviction of the oldest one
+        std::deque<const std::string *> order;
+      };
+
+      static constexpr size_t kShards = 16;
+
+      static std::string makeKey(const crypto::Hash &payload_hash,
+                                 const crypto::PublicKey &public_key,
+                                 const crypto::Signed &signed_data);
+
+      Shard &shard(const std::string &key);
+
+      size_t shard_capacity_;
+      std::array<Shard, kShards> shards_;
+      std::atomic<size_t> hits_{0};
+      std::atomic<size_t> misses_{0};
+    };
+
+  }  // namespace validation
+}  // namespace shared_model
+
+#endif  // IROHA_SHARED_MODEL_SIGNATURE_CACHE_HPP
@@ -216,14 +216,12 @@ namespace shared_model {
 
      private:
       FieldValidator validator_;
-      mutable int command_counter{0};
 
-      // adds command to a reason, appends and increments counter
+      // names a reason after the command, the visitor keeps no state, so
+      // it can be used concurrently
       void addInvalidCommand(ReasonsGroupType &reason,
                              const std::string &command_name) const {
-        reason.first =
-            (boost::format("%d %s") % command_counter % command_name).str();
-        command_counter++;
+        reason.first = command_name;
       }
     };
 
@@ -265,11 +263,16 @@ namespace shared_model {
           answer.addReason(std::move(tx_reason));
         }
 
+        size_t command_index = 0;
         for (const auto &command : tx.commands()) {
           auto reason = boost::apply_visitor(command_validator_, command.get());
           if (not reason.second.empty()) {
+            // the index keeps reasons of commands of the same type apart
+            reason.first =
+                (boost::format("%d %s") % command_index % reason.first).str();
             answer.addReason(std::move(reason));
           }
+          ++command_index;
         }
 
         return answer;
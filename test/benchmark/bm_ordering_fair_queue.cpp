@@ -0,0 +1,106 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+///
+/// Latency of small clients in the ordering service queue while a heavy
+/// client bursts transactions.
+/// Every round the heavy client submits a burst, each small client submits
+/// one transaction, and one proposal of max_size transactions is formed.
+/// Reported counters are latencies of small clients' transactions in rounds.
+///
+
+#include <benchmark/benchmark.h>
+#include <tbb/concurrent_queue.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "ordering/impl/creator_fair_queue.hpp"
+
+namespace {
+  /// Queued transaction stub: creator and round of submission
+  struct QueuedTx {
+    bool small;
+    size_t round;
+  };
+
+  /// FIFO queue used by ordering service before fair queuing
+  class FifoQueue {
+   public:
+    void push(const std::string &, QueuedTx tx) {
+      queue_.push(tx);
+    }
+
+    bool try_pop(QueuedTx &tx) {
+      return queue_.try_pop(tx);
+    }
+
+   private:
+    tbb::concurrent_queue<QueuedTx> queue_;
+  };
+
+  using FairQueue = iroha::ordering::CreatorFairQueue<QueuedTx>;
+
+  constexpr size_t kMaxProposalSize = 1000;
+  constexpr size_t kSmallClients = 100;
+  constexpr size_t kRounds = 50;
+
+  /**
+   * @tparam Queue - queue implementation
+   * @param state.range(0) - size of the heavy client burst per round
+   */
+  template <typename Queue>
+  void BM_SmallClientLatency(benchmark::State &state) {
+    const auto burst = static_cast<size_t>(state.range(0));
+    std::vector<std::string> small_clients;
+    for (size_t i = 0; i < kSmallClients; ++i) {
+      small_clients.push_back("small" + std::to_string(i) + "@domain");
+    }
+
+    std::vector<size_t> latencies;
+    while (state.KeepRunning()) {
+      Queue queue;
+      latencies.clear();
+      for (size_t round = 0; round < kRounds; ++round) {
+        for (size_t i = 0; i < burst; ++i) {
+          queue.push("heavy@domain", QueuedTx{false, round});
+        }
+        for (const auto &client : small_clients) {
+          queue.push(client, QueuedTx{true, round});
+        }
+        QueuedTx tx;
+        for (size_t i = 0; i < kMaxProposalSize and queue.try_pop(tx); ++i) {
+          if (tx.small) {
+            latencies.push_back(round - tx.round);
+          }
+        }
+      }
+    }
+
+    if (latencies.empty()) {
+      // small transactions never reached a proposal
+      state.counters["p99_rounds"] = kRounds;
+      state.counters["max_rounds"] = kRounds;
+      return;
+    }
+    std::sort(latencies.begin(), latencies.end());
+    state.counters["served"] = latencies.size();
+    state.counters["p99_rounds"] = latencies[latencies.size() * 99 / 100];
+    state.counters["max_rounds"] = latencies.back();
+  }
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_SmallClientLatency, FifoQueue)
+    ->Arg(0)
+    ->Arg(5000)
+    ->Arg(50000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_SmallClientLatency, FairQueue)
+    ->Arg(0)
+    ->Arg(5000)
+    ->Arg(50000)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
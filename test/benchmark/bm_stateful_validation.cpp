@@ -0,0 +1,104 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+///
+/// Throughput of stateful validation of a proposal by several workers.
+/// Temporary wsv is emulated: every application of a transaction waits for
+/// a fixed time, as a round trip to the database does, and forks are free.
+/// Given share of transactions transfers asset to the same hot account, so
+/// they conflict with each other and are validated by a single worker.
+///
+
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <thread>
+
+#include "ametsuchi/temporary_wsv.hpp"
+#include "datetime/time.hpp"
+#include "logger/logger.hpp"
+#include "module/shared_model/builders/protobuf/test_proposal_builder.hpp"
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+#include "validation/impl/stateful_validator_impl.hpp"
+
+namespace {
+  using namespace iroha;
+
+  constexpr size_t kTransactions = 200;
+  constexpr std::chrono::microseconds kApplyLatency(50);
+
+  /// Temporary wsv which accepts all transactions with database latency
+  class FakeTemporaryWsv : public ametsuchi::TemporaryWsv {
+   public:
+    bool apply(const shared_model::interface::Transaction &,
+               std::function<bool(const shared_model::interface::Transaction &,
+                                  ametsuchi::WsvQuery &)>) override {
+      std::this_thread::sleep_for(kApplyLatency);
+      return true;
+    }
+
+    expected::Result<std::unique_ptr<TemporaryWsv>, std::string> fork()
+        const override {
+      return expected::makeValue<std::unique_ptr<TemporaryWsv>>(
+          std::make_unique<FakeTemporaryWsv>());
+    }
+  };
+
+  /**
+   * @param conflicting - number of transactions which transfer to the hot
+   * account, other transactions access accounts of their own
+   */
+  auto makeProposal(size_t conflicting) {
+    std::vector<shared_model::proto::Transaction> transactions;
+    for (size_t i = 0; i < kTransactions; ++i) {
+      auto id = std::to_string(i);
+      auto dest = i < conflicting ? "hot@test" : "dest" + id + "@test";
+      transactions.push_back(
+          TestTransactionBuilder()
+              .createdTime(time::now())
+              .creatorAccountId("src" + id + "@test")
+              .quorum(1)
+              .transferAsset(
+                  "src" + id + "@test", dest, "coin#test", "", "1.0")
+              .build());
+    }
+    return TestProposalBuilder()
+        .height(2)
+        .createdTime(time::now())
+        .transactions(transactions)
+        .build();
+  }
+
+  /**
+   * @param state.range(0) - percent of conflicting transactions
+   * @param state.range(1) - number of workers
+   */
+  void BM_StatefulValidation(benchmark::State &state) {
+    spdlog::set_level(spdlog::level::off);
+    auto proposal = makeProposal(kTransactions * state.range(0) / 100);
+    validation::StatefulValidatorImpl validator(state.range(1));
+    FakeTemporaryWsv wsv;
+
+    while (state.KeepRunning()) {
+      benchmark::DoNotOptimize(validator.validate(proposal, wsv));
+    }
+
+    state.counters["transactions"] = benchmark::Counter(
+        state.iterations() * kTransactions, benchmark::Counter::kIsRate);
+  }
+}  // namespace
+
+BENCHMARK(BM_StatefulValidation)
+    ->Args({0, 1})
+    ->Args({0, 4})
+    ->Args({10, 1})
+    ->Args({10, 4})
+    ->Args({50, 1})
+    ->Args({50, 4})
+    ->Args({100, 1})
+    ->Args({100, 4})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+BENCHMARK_MAIN();
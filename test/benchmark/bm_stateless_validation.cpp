@@ -0,0 +1,127 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+///
+/// Throughput of stateless validation of blocks of different size.
+/// Block validator validates transactions on the shared thread pool when
+/// there are enough of them, the serial benchmark validates the same
+/// transactions one by one for comparison. Field benchmark measures
+/// recognition of the formats of identifiers alone.
+///
+
+#include <benchmark/benchmark.h>
+
+#include "datetime/time.hpp"
+#include "module/shared_model/builders/protobuf/test_block_builder.hpp"
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+#include "validators/default_validator.hpp"
+#include "validators/field_validator.hpp"
+
+namespace {
+  using namespace shared_model::validation;
+
+  /**
+   * @return block with given number of transactions of several commands
+   */
+  shared_model::proto::Block makeBlock(size_t size) {
+    std::vector<shared_model::proto::Transaction> transactions;
+    for (size_t i = 0; i < size; ++i) {
+      auto id = std::to_string(i);
+      transactions.push_back(
+          TestTransactionBuilder()
+              .createdTime(iroha::time::now())
+              .creatorAccountId("admin@test")
+              .quorum(1)
+              .createAccount("user" + id,
+                             "test",
+                             shared_model::interface::types::PubkeyType(
+                                 std::string(32, '0')))
+              .setAccountDetail("user" + id + "@test", "key", "value")
+              .transferAsset(
+                  "admin@test", "user" + id + "@test", "coin#test", "", "1.0")
+              .build());
+    }
+    return TestBlockBuilder()
+        .height(2)
+        .createdTime(iroha::time::now())
+        .prevHash(shared_model::crypto::Hash(std::string(32, '0')))
+        .transactions(transactions)
+        .build();
+  }
+
+  /**
+   * @param state.range(0) - number of transactions in block
+   */
+  void BM_BlockValidation(benchmark::State &state) {
+    auto block = makeBlock(state.range(0));
+    DefaultBlockValidator validator;
+
+    while (state.KeepRunning()) {
+      benchmark::DoNotOptimize(validator.validate(block));
+    }
+
+    state.counters["transactions"] = benchmark::Counter(
+        state.iterations() * state.range(0), benchmark::Counter::kIsRate);
+  }
+
+  /**
+   * @param state.range(0) - number of transactions in block
+   */
+  void BM_SerialTransactionsValidation(benchmark::State &state) {
+    auto block = makeBlock(state.range(0));
+    DefaultTransactionValidator validator;
+
+    while (state.KeepRunning()) {
+      for (const auto &tx : block.transactions()) {
+        benchmark::DoNotOptimize(validator.validate(tx));
+      }
+    }
+
+    state.counters["transactions"] = benchmark::Counter(
+        state.iterations() * state.range(0), benchmark::Counter::kIsRate);
+  }
+
+  /**
+   * Validates fields of a typical transfer and of a peer
+   */
+  void BM_FieldValidation(benchmark::State &state) {
+    FieldValidator validator;
+    ReasonsGroupType reason;
+
+    while (state.KeepRunning()) {
+      validator.validateAccountId(reason, "admin@test.iroha");
+      validator.validateAccountId(reason, "user_12345@test.iroha");
+      validator.validateAssetId(reason, "coin#test.iroha");
+      validator.validateDomainId(reason, "test.iroha");
+      validator.validateAccountDetailKey(reason, "some_detail_key");
+      validator.validatePeerAddress(reason, "192.168.100.200:50541");
+      validator.validatePeerAddress(reason, "node-1.iroha.tech:10001");
+    }
+
+    benchmark::DoNotOptimize(reason);
+    state.counters["fields"] =
+        benchmark::Counter(state.iterations() * 7, benchmark::Counter::kIsRate);
+  }
+}  // namespace
+
+BENCHMARK(BM_FieldValidation);
+BENCHMARK(BM_BlockValidation)
+    ->Arg(16)
+    ->Arg(64)
+    ->Arg(256)
+    ->Arg(1000)
+    ->Arg(5000)
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+BENCHMARK(BM_SerialTransactionsValidation)
+    ->Arg(16)
+    ->Arg(64)
+    ->Arg(256)
+    ->Arg(1000)
+    ->Arg(5000)
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,89 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+///
+/// Scalability of YAC consensus in an in-process simulated cluster.
+/// Every iteration runs kRounds rounds of a fresh cluster in virtual time,
+/// so wall time measures consensus logic and vote storage only.
+/// Reported counters: wall-clock rounds per second, messages per round,
+/// and virtual time to commit in milliseconds.
+///
+
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <numeric>
+
+#include "framework/yac_simulation/yac_simulation.hpp"
+#include "logger/logger.hpp"
+
+namespace {
+  using namespace iroha::consensus::yac::simulation;
+
+  constexpr size_t kRounds = 20;
+
+  void runSimulation(benchmark::State &state, SimulationConfig config) {
+    spdlog::set_level(spdlog::level::off);
+
+    SimulationStats stats;
+    while (state.KeepRunning()) {
+      YacSimulation simulation(config);
+      for (size_t i = 0; i < kRounds; ++i) {
+        simulation.runRound();
+      }
+      stats = simulation.stats();
+    }
+
+    state.counters["rounds"] = benchmark::Counter(
+        state.iterations() * kRounds, benchmark::Counter::kIsRate);
+    state.counters["committed"] = stats.committed_rounds;
+    state.counters["votes_per_round"] = stats.votes_sent / kRounds;
+    state.counters["commits_per_round"] = stats.commits_sent / kRounds;
+    if (stats.time_to_commit.empty()) {
+      return;
+    }
+    auto times = stats.time_to_commit;
+    std::sort(times.begin(), times.end());
+    state.counters["commit_ms_avg"] =
+        std::accumulate(times.begin(), times.end(), Duration(0)).count()
+        / static_cast<double>(times.size());
+    state.counters["commit_ms_max"] = times.back().count();
+  }
+
+  /**
+   * @param state.range(0) - number of peers
+   */
+  void BM_ReliableNetwork(benchmark::State &state) {
+    SimulationConfig config;
+    config.peers = state.range(0);
+    runSimulation(state, config);
+  }
+
+  /**
+   * Maximal tolerated number of crashed peers and 1% of lost messages
+   * @param state.range(0) - number of peers
+   */
+  void BM_FaultyNetwork(benchmark::State &state) {
+    SimulationConfig config;
+    config.peers = state.range(0);
+    config.crashed = (config.peers - 1) / 3;
+    config.loss = 0.01;
+    runSimulation(state, config);
+  }
+}  // namespace
+
+BENCHMARK(BM_ReliableNetwork)
+    ->Arg(4)
+    ->Arg(16)
+    ->Arg(64)
+    ->Arg(200)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_FaultyNetwork)
+    ->Arg(4)
+    ->Arg(16)
+    ->Arg(64)
+    ->Arg(200)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,103 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+///
+/// Throughput of vote ingestion by a single Yac instance.
+/// Every round all peers vote for the same 32-byte hash, the instance
+/// collects votes, commits and keeps answering late votes directly.
+/// Signatures are not verified, so the benchmark measures peer lookup and
+/// vote storage.
+///
+
+#include <benchmark/benchmark.h>
+#include <string>
+#include <vector>
+
+#include "builders/protobuf/common_objects/proto_peer_builder.hpp"
+#include "common/cloneable.hpp"
+#include "consensus/yac/cluster_order.hpp"
+#include "consensus/yac/storage/yac_vote_storage.hpp"
+#include "consensus/yac/yac.hpp"
+#include "framework/yac_simulation/yac_simulation.hpp"
+#include "logger/logger.hpp"
+
+namespace {
+  using namespace iroha::consensus::yac;
+  using namespace iroha::consensus::yac::simulation;
+
+  /// number of distinct rounds, larger than the number of retained rounds
+  constexpr size_t kRounds = 64;
+
+  /// Network which drops all messages
+  class NullNetwork : public YacNetwork {
+   public:
+    void subscribe(std::shared_ptr<YacNetworkNotifications>) override {}
+    void send_commit(const shared_model::interface::Peer &,
+                     const CommitMessage &) override {}
+    void send_reject(const shared_model::interface::Peer &,
+                     RejectMessage) override {}
+    void send_vote(const shared_model::interface::Peer &,
+                   VoteMessage) override {}
+  };
+
+  /**
+   * @return binary string of given size ending with decimal number
+   */
+  std::string makeKey(size_t number, size_t size = 32) {
+    auto id = std::to_string(number);
+    std::string key(size, '0');
+    key.replace(key.size() - id.size(), id.size(), id);
+    return key;
+  }
+
+  /**
+   * @param state.range(0) - number of peers
+   */
+  void BM_VoteIngestion(benchmark::State &state) {
+    spdlog::set_level(spdlog::level::off);
+    const auto number_of_peers = static_cast<size_t>(state.range(0));
+
+    std::vector<std::shared_ptr<shared_model::interface::Peer>> peers;
+    for (size_t i = 0; i < number_of_peers; ++i) {
+      peers.push_back(clone(
+          shared_model::proto::PeerBuilder()
+              .address("peer" + std::to_string(i))
+              .pubkey(shared_model::interface::types::PubkeyType(makeKey(i)))
+              .build()));
+    }
+
+    std::vector<std::vector<VoteMessage>> rounds(kRounds);
+    for (size_t round = 0; round < kRounds; ++round) {
+      auto hash = makeKey(round);
+      for (const auto &peer : peers) {
+        rounds[round].push_back(
+            SimulatedCryptoProvider(peer).getVote(YacHash(hash, hash)));
+      }
+    }
+
+    auto yac = Yac::create(
+        YacVoteStorage(),
+        std::make_shared<NullNetwork>(),
+        std::make_shared<SimulatedCryptoProvider>(peers.front()),
+        std::make_shared<VirtualTimer>(std::make_shared<VirtualClock>(),
+                                       Duration(1000)),
+        ClusterOrdering::create(peers).value());
+
+    size_t round = 0;
+    while (state.KeepRunning()) {
+      for (const auto &vote : rounds[round]) {
+        yac->on_vote(vote);
+      }
+      round = (round + 1) % kRounds;
+    }
+
+    state.counters["votes"] = benchmark::Counter(
+        state.iterations() * number_of_peers, benchmark::Counter::kIsRate);
+  }
+}  // namespace
+
+BENCHMARK(BM_VoteIngestion)->Arg(4)->Arg(16)->Arg(64)->Arg(200);
+
+BENCHMARK_MAIN();
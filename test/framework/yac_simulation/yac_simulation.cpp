@@ -0,0 +1,265 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "framework/yac_simulation/yac_simulation.hpp"
+
+#include <algorithm>
+
+#include "builders/protobuf/common_objects/proto_peer_builder.hpp"
+#include "builders/protobuf/common_objects/proto_signature_builder.hpp"
+#include "common/cloneable.hpp"
+#include "consensus/yac/cluster_order.hpp"
+#include "consensus/yac/storage/yac_vote_storage.hpp"
+#include "consensus/yac/yac.hpp"
+#include "interfaces/common_objects/peer.hpp"
+
+namespace iroha {
+  namespace consensus {
+    namespace yac {
+      namespace simulation {
+
+        // ------|VirtualClock|------
+
+        Duration VirtualClock::now() const {
+          return now_;
+        }
+
+        void VirtualClock::schedule(Duration delay,
+                                    std::function<void()> handler) {
+          events_.push(
+              Event{now_ + delay, next_sequence_++, std::move(handler)});
+        }
+
+        bool VirtualClock::runNext() {
+          if (events_.empty()) {
+            return false;
+          }
+          auto event = events_.top();
+          events_.pop();
+          now_ = event.time;
+          event.handler();
+          return true;
+        }
+
+        // ------|VirtualTimer|------
+
+        VirtualTimer::VirtualTimer(std::shared_ptr<VirtualClock> clock,
+                                   Duration delay)
+            : clock_(std::move(clock)),
+              delay_(delay),
+              generation_(std::make_shared<uint64_t>(0)) {}
+
+        void VirtualTimer::invokeAfterDelay(std::function<void()> handler) {
+          auto generation = ++*generation_;
+          std::weak_ptr<uint64_t> current = generation_;
+          clock_->schedule(delay_, [current, generation, handler] {
+            auto value = current.lock();
+            if (value and *value == generation) {
+              handler();
+            }
+          });
+        }
+
+        void VirtualTimer::deny() {
+          ++*generation_;
+        }
+
+        // ------|SimulatedYacNetwork|------
+
+        SimulatedYacNetwork::SimulatedYacNetwork(YacSimulation &simulation,
+                                                 size_t peer)
+            : simulation_(simulation), peer_(peer) {}
+
+        void SimulatedYacNetwork::subscribe(
+            std::shared_ptr<YacNetworkNotifications> handler) {
+          simulation_.handlers_.at(peer_) = handler;
+        }
+
+        void SimulatedYacNetwork::send_commit(
+            const shared_model::interface::Peer &to,
+            const CommitMessage &commit) {
+          ++simulation_.stats_.commits_sent;
+          simulation_.send(to, [commit](auto &handler) {
+            handler.on_commit(commit);
+          });
+        }
+
+        void SimulatedYacNetwork::send_reject(
+            const shared_model::interface::Peer &to, RejectMessage reject) {
+          ++simulation_.stats_.rejects_sent;
+          simulation_.send(to, [reject](auto &handler) {
+            handler.on_reject(reject);
+          });
+        }
+
+        void SimulatedYacNetwork::send_vote(
+            const shared_model::interface::Peer &to, VoteMessage vote) {
+          ++simulation_.stats_.votes_sent;
+          simulation_.send(
+              to, [vote](auto &handler) { handler.on_vote(vote); });
+        }
+
+        // ------|SimulatedCryptoProvider|------
+
+        SimulatedCryptoProvider::SimulatedCryptoProvider(
+            std::shared_ptr<shared_model::interface::Peer> peer)
+            : signature_(clone(shared_model::proto::SignatureBuilder()
+                                   .publicKey(peer->pubkey())
+                                   .build())) {}
+
+        bool SimulatedCryptoProvider::verify(CommitMessage msg) {
+          return true;
+        }
+
+        bool SimulatedCryptoProvider::verify(RejectMessage msg) {
+          return true;
+        }
+
+        bool SimulatedCryptoProvider::verify(VoteMessage msg) {
+          return true;
+        }
+
+        VoteMessage SimulatedCryptoProvider::getVote(YacHash hash) {
+          VoteMessage vote;
+          vote.hash = std::move(hash);
+          vote.signature = signature_;
+          return vote;
+        }
+
+        // ------|YacSimulation|------
+
+        YacSimulation::YacSimulation(SimulationConfig config)
+            : config_(config),
+              clock_(std::make_shared<VirtualClock>()),
+              random_(config.seed),
+              handlers_(config.peers),
+              commits_(config.peers) {
+          for (size_t i = 0; i < config_.peers; ++i) {
+            // keys of different peers differ in trailing digits
+            auto id = std::to_string(i);
+            std::string key(32, '0');
+            key.replace(key.size() - id.size(), id.size(), id);
+            auto address = "peer" + id;
+            peers_.push_back(clone(
+                shared_model::proto::PeerBuilder()
+                    .address(address)
+                    .pubkey(shared_model::interface::types::PubkeyType(key))
+                    .build()));
+            peer_indices_.emplace(address, i);
+          }
+
+          auto order = ClusterOrdering::create(peers_).value();
+          for (size_t i = 0; i < config_.peers; ++i) {
+            auto network = std::make_shared<SimulatedYacNetwork>(*this, i);
+            auto yac = Yac::create(
+                YacVoteStorage(),
+                network,
+                std::make_shared<SimulatedCryptoProvider>(peers_.at(i)),
+                std::make_shared<VirtualTimer>(clock_, config_.vote_delay),
+                order);
+            network->subscribe(yac);
+            yac->on_commit().subscribe(
+                subscriptions_, [this, i](const CommitMessage &commit) {
+                  const auto &hash = commit.votes.at(0).hash;
+                  commits_.at(i).emplace(hash.proposal_hash, hash);
+                  if (this->isCorrect(i)
+                      and hash.proposal_hash == current_proposal_) {
+                    commit_times_.push_back(clock_->now());
+                  }
+                });
+            yacs_.push_back(std::move(yac));
+          }
+        }
+
+        YacSimulation::~YacSimulation() {
+          subscriptions_.unsubscribe();
+        }
+
+        bool YacSimulation::runRound() {
+          auto round = std::to_string(stats_.rounds++);
+          current_proposal_ = "proposal" + round;
+          YacHash hash(current_proposal_, "block" + round);
+          YacHash conflicting(current_proposal_, "conflicting" + round);
+
+          auto rotated = peers_;
+          std::rotate(rotated.begin(),
+                      rotated.begin() + (stats_.rounds - 1) % rotated.size(),
+                      rotated.end());
+          auto order = ClusterOrdering::create(rotated).value();
+
+          commit_times_.clear();
+          auto start = clock_->now();
+          for (size_t i = config_.crashed; i < config_.peers; ++i) {
+            yacs_.at(i)->vote(isCorrect(i) ? hash : conflicting, order);
+          }
+          while (clock_->runNext()) {
+          }
+
+          auto correct = config_.peers - config_.crashed - config_.byzantine;
+          auto committed = commit_times_.size() == correct;
+          for (size_t i = config_.crashed + config_.byzantine;
+               committed and i < config_.peers;
+               ++i) {
+            committed = commits_.at(i).at(current_proposal_) == hash;
+          }
+
+          if (committed) {
+            auto time = *std::max_element(commit_times_.begin(),
+                                          commit_times_.end())
+                - start;
+            ++stats_.committed_rounds;
+            stats_.time_to_commit.push_back(time);
+            stats_.total_time += time;
+          } else {
+            stats_.total_time += clock_->now() - start;
+          }
+          return committed;
+        }
+
+        const SimulationStats &YacSimulation::stats() const {
+          return stats_;
+        }
+
+        const std::unordered_map<std::string, YacHash> &YacSimulation::commits(
+            size_t peer) const {
+          return commits_.at(peer);
+        }
+
+        const std::vector<std::shared_ptr<shared_model::interface::Peer>>
+            &YacSimulation::peers() const {
+          return peers_;
+        }
+
+        void YacSimulation::send(
+            const shared_model::interface::Peer &to,
+            std::function<void(YacNetworkNotifications &)> deliver) {
+          auto peer = peer_indices_.at(to.address());
+          if (peer < config_.crashed) {
+            return;
+          }
+          if (std::uniform_real_distribution<double>()(random_)
+              < config_.loss) {
+            ++stats_.messages_lost;
+            return;
+          }
+          auto latency = std::uniform_int_distribution<Duration::rep>(
+              config_.min_latency.count(),
+              config_.max_latency.count())(random_);
+          std::weak_ptr<YacNetworkNotifications> handler = handlers_.at(peer);
+          clock_->schedule(Duration(latency), [handler, deliver] {
+            if (auto notifications = handler.lock()) {
+              deliver(*notifications);
+            }
+          });
+        }
+
+        bool YacSimulation::isCorrect(size_t peer) const {
+          return peer >= config_.crashed + config_.byzantine;
+        }
+
+      }  // namespace simulation
+    }    // namespace yac
+  }      // namespace consensus
+}  // namespace iroha
@@ -0,0 +1,253 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_YAC_SIMULATION_HPP
+#define IROHA_YAC_SIMULATION_HPP
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <queue>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <rxcpp/rx.hpp>
+
+#include "consensus/yac/messages.hpp"
+#include "consensus/yac/timer.hpp"
+#include "consensus/yac/transport/yac_network_interface.hpp"
+#include "consensus/yac/yac_crypto_provider.hpp"
+
+namespace shared_model {
+  namespace interface {
+    class Peer;
+  }  // namespace interface
+}  // namespace shared_model
+
+namespace iroha {
+  namespace consensus {
+    namespace yac {
+
+      class Yac;
+
+      namespace simulation {
+
+        using Duration = std::chrono::milliseconds;
+
+        /**
+         * Discrete event loop in virtual time. Events are run in order of
+         * their time, events of the same time in order of scheduling.
+         */
+        class VirtualClock {
+         public:
+          /**
+           * @return current virtual time since start of simulation
+           */
+          Duration now() const;
+
+          /**
+           * Schedule handler to be invoked after delay
+           */
+          void schedule(Duration delay, std::function<void()> handler);
+
+          /**
+           * Advance time to the next event and run it
+           * @return false if there are no events
+           */
+          bool runNext();
+
+         private:
+          struct Event {
+            Duration time;
+            uint64_t sequence;
+            std::function<void()> handler;
+          };
+
+          struct Later {
+            bool operator()(const Event &lhs, const Event &rhs) const {
+              return lhs.time > rhs.time
+                  or (lhs.time == rhs.time and lhs.sequence > rhs.sequence);
+            }
+          };
+
+          std::priority_queue<Event, std::vector<Event>, Later> events_;
+          Duration now_{0};
+          uint64_t next_sequence_{0};
+        };
+
+        /**
+         * Timer which invokes handler after fixed delay of virtual time
+         */
+        class VirtualTimer : public Timer {
+         public:
+          VirtualTimer(std::shared_ptr<VirtualClock> clock, Duration delay);
+
+          void invokeAfterDelay(std::function<void()> handler) override;
+
+          void deny() override;
+
+         private:
+          std::shared_ptr<VirtualClock> clock_;
+          Duration delay_;
+          /// incremented on every change, so stale handlers are skipped
+          std::shared_ptr<uint64_t> generation_;
+        };
+
+        /**
+         * Parameters of simulated cluster and network
+         */
+        struct SimulationConfig {
+          /// number of peers in cluster
+          size_t peers = 4;
+          /// number of peers which do not send or receive messages
+          size_t crashed = 0;
+          /// number of peers which vote for a conflicting block
+          size_t byzantine = 0;
+          /// bounds of uniformly distributed message latency
+          Duration min_latency{1};
+          Duration max_latency{10};
+          /// probability of losing a message
+          double loss = 0;
+          /// delay between votes sent to successive leaders
+          Duration vote_delay{100};
+          /// seed of random generator for latency and loss
+          uint64_t seed = 0;
+        };
+
+        /**
+         * Counters collected during simulation
+         */
+        struct SimulationStats {
+          size_t rounds = 0;
+          /// rounds committed by all correct peers
+          size_t committed_rounds = 0;
+          size_t votes_sent = 0;
+          size_t commits_sent = 0;
+          size_t rejects_sent = 0;
+          size_t messages_lost = 0;
+          /// virtual time from start of round to commit on the last correct
+          /// peer, for committed rounds
+          std::vector<Duration> time_to_commit;
+          /// virtual time of all rounds
+          Duration total_time{0};
+        };
+
+        class YacSimulation;
+
+        /**
+         * YacNetwork endpoint of a single peer in simulated network
+         */
+        class SimulatedYacNetwork : public YacNetwork {
+         public:
+          SimulatedYacNetwork(YacSimulation &simulation, size_t peer);
+
+          void subscribe(
+              std::shared_ptr<YacNetworkNotifications> handler) override;
+
+          void send_commit(const shared_model::interface::Peer &to,
+                           const CommitMessage &commit) override;
+
+          void send_reject(const shared_model::interface::Peer &to,
+                           RejectMessage reject) override;
+
+          void send_vote(const shared_model::interface::Peer &to,
+                         VoteMessage vote) override;
+
+         private:
+          YacSimulation &simulation_;
+          size_t peer_;
+        };
+
+        /**
+         * Crypto provider which signs votes with the key of the peer and
+         * accepts all messages, so the simulation measures consensus logic
+         * only
+         */
+        class SimulatedCryptoProvider : public YacCryptoProvider {
+         public:
+          explicit SimulatedCryptoProvider(
+              std::shared_ptr<shared_model::interface::Peer> peer);
+
+          bool verify(CommitMessage msg) override;
+
+          bool verify(RejectMessage msg) override;
+
+          bool verify(VoteMessage msg) override;
+
+          VoteMessage getVote(YacHash hash) override;
+
+         private:
+          std::shared_ptr<shared_model::interface::Signature> signature_;
+        };
+
+        /**
+         * Deterministic in-process cluster of Yac instances connected by
+         * simulated network with virtual time.
+         * Crashed peers are the first ones in the initial order, so they are
+         * also the first leaders of some rounds. Byzantine peers follow them
+         * and vote for a conflicting block.
+         */
+        class YacSimulation {
+         public:
+          explicit YacSimulation(SimulationConfig config);
+
+          ~YacSimulation();
+
+          /**
+           * Run one consensus round until no messages are in flight.
+           * Leader order is rotated every round.
+           * @return true if all correct peers committed the block of the
+           * round
+           */
+          bool runRound();
+
+          const SimulationStats &stats() const;
+
+          /**
+           * @return hashes committed by peer by proposal hash
+           */
+          const std::unordered_map<std::string, YacHash> &commits(
+              size_t peer) const;
+
+          const std::vector<std::shared_ptr<shared_model::interface::Peer>>
+              &peers() const;
+
+         private:
+          friend class SimulatedYacNetwork;
+
+          /**
+           * Deliver message to peer with random latency unless it is lost
+           * @param to - recipient
+           * @param deliver - invokes handler of the message
+           */
+          void send(const shared_model::interface::Peer &to,
+                    std::function<void(YacNetworkNotifications &)> deliver);
+
+          bool isCorrect(size_t peer) const;
+
+          SimulationConfig config_;
+          SimulationStats stats_;
+          std::shared_ptr<VirtualClock> clock_;
+          std::mt19937_64 random_;
+
+          std::vector<std::shared_ptr<shared_model::interface::Peer>> peers_;
+          std::unordered_map<std::string, size_t> peer_indices_;
+          std::vector<std::shared_ptr<Yac>> yacs_;
+          std::vector<std::weak_ptr<YacNetworkNotifications>> handlers_;
+          std::vector<std::unordered_map<std::string, YacHash>> commits_;
+          /// virtual time of commit of current round by correct peers
+          std::vector<Duration> commit_times_;
+          std::string current_proposal_;
+          rxcpp::composite_subscription subscriptions_;
+        };
+
+      }  // namespace simulation
+    }    // namespace yac
+  }      // namespace consensus
+}  // namespace iroha
+
+#endif  // IROHA_YAC_SIMULATION_HPP
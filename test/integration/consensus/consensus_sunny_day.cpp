@@ -60,6 +60,7 @@ class ConsensusSunnyDayTest : public ::testing::Test {
   std::unique_ptr<grpc::Server> server;
   std::shared_ptr<NetworkImpl> network;
   std::shared_ptr<MockYacCryptoProvider> crypto;
+  std::shared_ptr<iroha::timer::TimerWheel> wheel;
   std::shared_ptr<TimerImpl> timer;
   uint64_t delay = 3 * 1000;
   std::shared_ptr<Yac> yac;
@@ -69,14 +70,11 @@ class ConsensusSunnyDayTest : public ::testing::Test {
   void SetUp() override {
     network = std::make_shared<NetworkImpl>();
     crypto = std::make_shared<FixedCryptoProvider>(std::to_string(my_num));
-    timer = std::make_shared<TimerImpl>([this] {
-      // static factory with a single thread
-      // see YacInit::createTimer in consensus_init.cpp
-      static rxcpp::observe_on_one_worker coordination(
-          rxcpp::observe_on_new_thread().create_coordinator().get_scheduler());
-      return rxcpp::observable<>::timer(std::chrono::milliseconds(delay),
-                                        coordination);
-    });
+    wheel = std::make_shared<iroha::timer::TimerWheel>(
+        std::chrono::milliseconds(10));
+    wheel->start();
+    timer = std::make_shared<TimerImpl>(wheel,
+                                        std::chrono::milliseconds(delay));
     auto order = ClusterOrdering::create(default_peers);
     ASSERT_TRUE(order);
 
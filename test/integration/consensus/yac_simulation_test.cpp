@@ -0,0 +1,128 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <gtest/gtest.h>
+
+#include "framework/yac_simulation/yac_simulation.hpp"
+#include "logger/logger.hpp"
+
+using namespace iroha::consensus::yac;
+using namespace iroha::consensus::yac::simulation;
+using namespace std::chrono_literals;
+
+class YacSimulationTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    // every peer logs every message, which dominates the running time
+    spdlog::set_level(spdlog::level::off);
+  }
+
+  /**
+   * Run rounds of simulation
+   * @return number of committed rounds
+   */
+  size_t run(YacSimulation &simulation, size_t rounds) {
+    size_t committed = 0;
+    for (size_t i = 0; i < rounds; ++i) {
+      committed += simulation.runRound();
+    }
+    return committed;
+  }
+
+  const size_t rounds = 10;
+};
+
+/**
+ * @given simulated cluster of 4 peers with reliable network
+ * @when rounds are run
+ * @then every round is committed by all peers
+ * AND every peer sends a single vote per round, because commit arrives
+ * before the vote delay expires
+ * AND the leader sends commit to all peers and directly to the last voter
+ */
+TEST_F(YacSimulationTest, AllPeersCommit) {
+  SimulationConfig config;
+  YacSimulation simulation(config);
+
+  ASSERT_EQ(rounds, run(simulation, rounds));
+
+  const auto &stats = simulation.stats();
+  EXPECT_EQ(rounds, stats.rounds);
+  EXPECT_EQ(config.peers * rounds, stats.votes_sent);
+  EXPECT_EQ((config.peers + 1) * rounds, stats.commits_sent);
+  EXPECT_EQ(0, stats.messages_lost);
+  ASSERT_EQ(rounds, stats.time_to_commit.size());
+  for (auto time : stats.time_to_commit) {
+    EXPECT_LE(time, 2 * config.max_latency);
+  }
+}
+
+/**
+ * @given simulated cluster of 7 peers where 2 peers crashed
+ * @when rounds are run, so crashed peers are the first leaders of some
+ * rounds
+ * @then every round is committed by correct peers
+ * AND rounds with crashed first leader take longer than vote delay
+ */
+TEST_F(YacSimulationTest, CommitWithCrashedPeers) {
+  SimulationConfig config;
+  config.peers = 7;
+  config.crashed = 2;
+  YacSimulation simulation(config);
+
+  ASSERT_EQ(config.peers, run(simulation, config.peers));
+
+  const auto &times = simulation.stats().time_to_commit;
+  EXPECT_GE(times.at(0), config.vote_delay);
+  EXPECT_LE(times.at(config.crashed), 2 * config.max_latency);
+}
+
+/**
+ * @given simulated cluster of 4 peers where one peer votes for a
+ * conflicting block
+ * @when rounds are run
+ * @then correct peers commit the block of correct peers
+ */
+TEST_F(YacSimulationTest, CommitWithByzantinePeer) {
+  SimulationConfig config;
+  config.byzantine = 1;
+  YacSimulation simulation(config);
+
+  ASSERT_EQ(rounds, run(simulation, rounds));
+  EXPECT_EQ("block0", simulation.commits(1).at("proposal0").block_hash);
+}
+
+/**
+ * @given two simulations with the same config and lossy network
+ * @when the same number of rounds is run
+ * @then they produce the same statistics
+ */
+TEST_F(YacSimulationTest, Deterministic) {
+  SimulationConfig config;
+  config.peers = 10;
+  config.loss = 0.1;
+  config.seed = 42;
+  YacSimulation first(config), second(config);
+
+  EXPECT_EQ(run(first, rounds), run(second, rounds));
+  EXPECT_EQ(first.stats().votes_sent, second.stats().votes_sent);
+  EXPECT_EQ(first.stats().commits_sent, second.stats().commits_sent);
+  EXPECT_EQ(first.stats().messages_lost, second.stats().messages_lost);
+  EXPECT_EQ(first.stats().time_to_commit, second.stats().time_to_commit);
+}
+
+/**
+ * @given simulated cluster of 100 peers with reliable network
+ * @when a round is run
+ * @then it is committed by all peers
+ */
+TEST_F(YacSimulationTest, LargeCluster) {
+  SimulationConfig config;
+  config.peers = 100;
+  YacSimulation simulation(config);
+
+  ASSERT_TRUE(simulation.runRound());
+  EXPECT_EQ(config.peers, simulation.stats().votes_sent);
+}
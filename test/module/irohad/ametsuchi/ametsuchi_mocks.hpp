@@ -36,6 +36,9 @@ namespace iroha {
   namespace ametsuchi {
     class MockWsvQuery : public WsvQuery {
      public:
+      using AccountsSignatories = std::vector<
+          std::pair<std::string, shared_model::interface::types::PubkeyType>>;
+
       MOCK_METHOD1(getAccountRoles,
                    boost::optional<std::vector<std::string>>(
                        const std::string &account_id));
@@ -53,6 +56,14 @@ namespace iroha {
                    boost::optional<
                        std::vector<shared_model::interface::types::PubkeyType>>(
                        const std::string &account_id));
+      MOCK_METHOD1(
+          getAccounts,
+          boost::optional<
+              std::vector<std::shared_ptr<shared_model::interface::Account>>>(
+              const std::vector<std::string> &account_ids));
+      MOCK_METHOD1(getAccountsSignatories,
+                   boost::optional<AccountsSignatories>(
+                       const std::vector<std::string> &account_ids));
       MOCK_METHOD1(
           getAsset,
           boost::optional<std::shared_ptr<shared_model::interface::Asset>>(
@@ -171,20 +182,42 @@ namespace iroha {
       MOCK_METHOD2(getBlocks,
                    rxcpp::observable<wBlock>(
                        shared_model::interface::types::HeightType, uint32_t));
+      MOCK_METHOD2(getBlockTransports,
+                   rxcpp::observable<wBlockTransport>(
+                       shared_model::interface::types::HeightType, uint32_t));
       MOCK_METHOD1(getBlocksFrom,
                    rxcpp::observable<wBlock>(
                        shared_model::interface::types::HeightType));
       MOCK_METHOD1(getTopBlocks, rxcpp::observable<wBlock>(uint32_t));
       MOCK_METHOD0(getTopBlock, expected::Result<wBlock, std::string>(void));
       MOCK_METHOD1(hasTxWithHash, bool(const shared_model::crypto::Hash &hash));
+      MOCK_METHOD1(getTxHashesFrom,
+                   std::vector<shared_model::crypto::Hash>(
+                       shared_model::interface::types::HeightType));
       MOCK_METHOD0(getTopBlockHeight, uint32_t(void));
     };
 
+    class MockTemporaryWsv : public TemporaryWsv {
+     public:
+      MOCK_METHOD2(
+          apply,
+          bool(const shared_model::interface::Transaction &,
+               std::function<bool(const shared_model::interface::Transaction &,
+                                  WsvQuery &)>));
+      MOCK_CONST_METHOD0(
+          fork,
+          expected::Result<std::unique_ptr<TemporaryWsv>, std::string>());
+    };
+
     class MockTemporaryFactory : public TemporaryFactory {
      public:
       MOCK_METHOD0(
           createTemporaryWsv,
           expected::Result<std::unique_ptr<TemporaryWsv>, std::string>(void));
+      MOCK_METHOD1(
+          createTemporaryWsv,
+          expected::Result<std::unique_ptr<TemporaryWsv>, std::string>(
+              const shared_model::interface::Block &));
     };
 
     class MockMutableStorage : public MutableStorage {
@@ -237,6 +270,10 @@ namespace iroha {
       MOCK_METHOD0(
           createTemporaryWsv,
           expected::Result<std::unique_ptr<TemporaryWsv>, std::string>(void));
+      MOCK_METHOD1(
+          createTemporaryWsv,
+          expected::Result<std::unique_ptr<TemporaryWsv>, std::string>(
+              const shared_model::interface::Block &));
       MOCK_METHOD0(
           createMutableStorage,
           expected::Result<std::unique_ptr<MutableStorage>, std::string>(void));
@@ -22,6 +22,7 @@
 #include "ametsuchi/impl/postgres_wsv_query.hpp"
 #include "ametsuchi/impl/wsv_restorer_impl.hpp"
 #include "ametsuchi/mutable_storage.hpp"
+#include "ametsuchi/temporary_wsv.hpp"
 #include "builders/default_builders.hpp"
 #include "builders/protobuf/transaction.hpp"
 #include "framework/result_fixture.hpp"
@@ -779,8 +780,8 @@ TEST_F(AmetsuchiTest, FindTxByHashTest) {
 
 /**
  * @given initialized storage for ordering service
- * @when save proposal height
- * @then load proposal height and ensure it is correct
+ * @when save proposal height and height of passed proposal
+ * @then load them and ensure they are correct
  */
 TEST_F(AmetsuchiTest, OrderingServicePersistentStorageTest) {
   std::shared_ptr<iroha::ametsuchi::PostgresOrderingServicePersistentState>
@@ -801,8 +802,12 @@ TEST_F(AmetsuchiTest, OrderingServicePersistentStorageTest) {
   ASSERT_EQ(11, ordering_state->loadProposalHeight().value());
   ASSERT_TRUE(ordering_state->saveProposalHeight(33));
   ASSERT_EQ(33, ordering_state->loadProposalHeight().value());
+  ASSERT_EQ(0, ordering_state->loadPassedProposalHeight().value());
+  ASSERT_TRUE(ordering_state->savePassedProposalHeight(7));
+  ASSERT_EQ(7, ordering_state->loadPassedProposalHeight().value());
   ordering_state->resetState();
   ASSERT_EQ(2, ordering_state->loadProposalHeight().value());
+  ASSERT_EQ(0, ordering_state->loadPassedProposalHeight().value());
 }
 
 /**
@@ -842,6 +847,37 @@ TEST_F(AmetsuchiTest, OrderingServicePersistentStorageRestartTest) {
   ASSERT_EQ(11, ordering_state->loadProposalHeight().value());
 }
 
+/**
+ * @given storage for ordering service without ordering gate table
+ * @when storage is created again without reset
+ * @then height of passed proposal is saved and loaded
+ */
+TEST_F(AmetsuchiTest, OrderingGateStateCreatedWithoutResetTest) {
+  std::shared_ptr<iroha::ametsuchi::PostgresOrderingServicePersistentState>
+      ordering_state;
+  auto create = [&] {
+    iroha::ametsuchi::PostgresOrderingServicePersistentState::create(pgopt_)
+        .match(
+            [&](iroha::expected::Value<std::shared_ptr<
+                    iroha::ametsuchi::PostgresOrderingServicePersistentState>>
+                    &_storage) { ordering_state = _storage.value; },
+            [](iroha::expected::Error<std::string> &error) {
+              FAIL() << "PostgresOrderingServicePersistentState: "
+                     << error.error;
+            });
+  };
+  create();
+  ASSERT_TRUE(ordering_state);
+  ASSERT_TRUE(ordering_state->dropStorgage());
+
+  ordering_state.reset();
+  create();
+  ASSERT_TRUE(ordering_state);
+  ASSERT_EQ(0, ordering_state->loadPassedProposalHeight().value());
+  ASSERT_TRUE(ordering_state->savePassedProposalHeight(7));
+  ASSERT_EQ(7, ordering_state->loadPassedProposalHeight().value());
+}
+
 /**
  * @given 2 different initialized storages for ordering service
  * @when save proposal height to the first one
@@ -952,3 +988,86 @@ DELETE FROM domain;
   res = storage->getWsvQuery()->getDomain("test");
   EXPECT_TRUE(res);
 }
+
+/**
+ * Fixture with committed block 1, which creates account admin@test with
+ * permission to add asset quantity, and block 2 adding 10.0 coin#test to
+ * its balance
+ */
+class TemporaryWsvOnBlockTest : public AmetsuchiTest {
+ public:
+  void SetUp() override {
+    AmetsuchiTest::SetUp();
+    auto block1 =
+        TestBlockBuilder()
+            .transactions(std::vector<shared_model::proto::Transaction>(
+                {TestTransactionBuilder()
+                     .creatorAccountId("admin@test")
+                     .createRole("admin", {Role::kAddAssetQty})
+                     .createDomain("test", "admin")
+                     .createAccount("admin", "test", fake_pubkey)
+                     .createAsset("coin", "test", 1)
+                     .build()}))
+            .height(1)
+            .prevHash(fake_hash)
+            .build();
+    apply(storage, block1);
+    block2 = std::make_shared<shared_model::proto::Block>(
+        TestBlockBuilder()
+            .transactions(std::vector<shared_model::proto::Transaction>(
+                {TestTransactionBuilder()
+                     .creatorAccountId("admin@test")
+                     .addAssetQuantity("admin@test", "coin#test", "10.0")
+                     .build()}))
+            .height(2)
+            .prevHash(block1.hash())
+            .build());
+  }
+
+  /**
+   * Check balance of admin@test in temporary wsv on top of block 2
+   * @param balance - expected balance
+   */
+  void validateBalance(const std::string &balance) {
+    std::unique_ptr<TemporaryWsv> wsv;
+    storage->createTemporaryWsv(*block2).match(
+        [&](iroha::expected::Value<std::unique_ptr<TemporaryWsv>> &value) {
+          wsv = std::move(value.value);
+        },
+        [](iroha::expected::Error<std::string> &error) {
+          FAIL() << "TemporaryWsv: " << error.error;
+        });
+    ASSERT_TRUE(wsv);
+    // the check function reads state and rejects the empty transaction
+    wsv->apply(TestTransactionBuilder().creatorAccountId("admin@test").build(),
+               [&](const auto &, auto &queries) {
+                 validateAccountAsset(
+                     &queries,
+                     "admin@test",
+                     "coin#test",
+                     *getAmount(AmountBuilder::fromString(balance)));
+                 return false;
+               });
+  }
+
+  std::shared_ptr<shared_model::proto::Block> block2;
+};
+
+/**
+ * @given block 2, which is not committed
+ * @when temporary wsv on top of block 2 is created
+ * @then it contains the state after block 2
+ */
+TEST_F(TemporaryWsvOnBlockTest, UncommittedBlockIsApplied) {
+  validateBalance("10.0");
+}
+
+/**
+ * @given block 2, which is committed before temporary wsv is created
+ * @when temporary wsv on top of block 2 is created
+ * @then block 2 is not applied again
+ */
+TEST_F(TemporaryWsvOnBlockTest, CommittedBlockIsNotAppliedAgain) {
+  apply(storage, *block2);
+  validateBalance("10.0");
+}
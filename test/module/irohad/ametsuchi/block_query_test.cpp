@@ -15,8 +15,10 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <boost/filesystem.hpp>
 #include <boost/optional.hpp>
+#include <limits>
 #include "ametsuchi/impl/postgres_block_index.hpp"
 #include "ametsuchi/impl/postgres_block_query.hpp"
 #include "converters/protobuf/json_proto_converter.hpp"
@@ -276,6 +278,32 @@ TEST_F(BlockQueryTest, GetBlocks_Count0) {
   ASSERT_TRUE(wrapper.validate());
 }
 
+/**
+ * @given block store with 2 blocks totally containing 3 txs created by
+ * user1@test AND 1 tx created by user2@test
+ * @when blocks are requested in transport format from height 1
+ * @then all blocks are returned in order
+ * AND they are equal to blocks returned as models
+ */
+TEST_F(BlockQueryTest, GetBlockTransports) {
+  std::vector<std::string> models;
+  blocks->getBlocks(1, 2).as_blocking().subscribe([&models](auto block) {
+    models.push_back(std::static_pointer_cast<shared_model::proto::Block>(block)
+                         ->getTransport()
+                         .SerializeAsString());
+  });
+  auto wrapper = make_test_subscriber<CallExact>(
+      blocks->getBlockTransports(1, std::numeric_limits<uint32_t>::max()),
+      blocks_total);
+  size_t height = 1;
+  wrapper.subscribe([&height, &models](auto block) {
+    EXPECT_EQ(height, block->payload().height());
+    EXPECT_EQ(models.at(height - 1), block->SerializeAsString());
+    ++height;
+  });
+  ASSERT_TRUE(wrapper.validate());
+}
+
 /**
  * @given block store with 2 blocks totally containing 3 txs created by
  * user1@test AND 1 tx created by user2@test
@@ -399,6 +427,29 @@ TEST_F(BlockQueryTest, HasTxWithInvalidHash) {
   EXPECT_FALSE(blocks->hasTxWithHash(invalid_tx_hash));
 }
 
+/**
+ * @given block store with 2 blocks totally containing 4 txs
+ * @when getTxHashesFrom is invoked with height of the second block
+ * @then hashes of txs of the second block are returned
+ */
+TEST_F(BlockQueryTest, GetTxHashesFromSecondBlock) {
+  auto hashes = blocks->getTxHashesFrom(2);
+  ASSERT_EQ(hashes.size(), 2);
+  for (auto i = 2u; i < tx_hashes.size(); ++i) {
+    EXPECT_NE(std::find(hashes.begin(), hashes.end(), tx_hashes[i]),
+              hashes.end());
+  }
+}
+
+/**
+ * @given block store with 2 blocks
+ * @when getTxHashesFrom is invoked with height after the top block
+ * @then no hashes are returned
+ */
+TEST_F(BlockQueryTest, GetTxHashesFromNonExistingHeight) {
+  EXPECT_TRUE(blocks->getTxHashesFrom(3).empty());
+}
+
 /**
  * @given block store with preinserted blocks
  * @when getTopBlock is invoked on this block store
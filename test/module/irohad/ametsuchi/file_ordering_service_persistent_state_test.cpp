@@ -0,0 +1,155 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/file_ordering_service_persistent_state.hpp"
+
+#include <gtest/gtest.h>
+#include <boost/filesystem.hpp>
+#include <fstream>
+#include <thread>
+
+#include "framework/result_fixture.hpp"
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+
+using namespace iroha::ametsuchi;
+using namespace framework::expected;
+namespace fs = boost::filesystem;
+
+class FileOrderingServicePersistentStateTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    fs::create_directory(directory);
+  }
+
+  void TearDown() override {
+    fs::remove_all(directory);
+  }
+
+  std::shared_ptr<FileOrderingServicePersistentState> open() {
+    auto state = val(FileOrderingServicePersistentState::create(path));
+    EXPECT_TRUE(state);
+    return state->value;
+  }
+
+  auto makeTx(shared_model::interface::types::TimestampType time) {
+    return TestTransactionBuilder().createdTime(time).build();
+  }
+
+  std::string directory =
+      (fs::temp_directory_path() / fs::unique_path()).string();
+  std::string path = (fs::path(directory) / "ordering_service.log").string();
+};
+
+/**
+ * @given new log
+ * @when proposal height is loaded
+ * @then default height 2 is returned and there are no transactions
+ */
+TEST_F(FileOrderingServicePersistentStateTest, EmptyLog) {
+  auto state = open();
+  ASSERT_EQ(*state->loadProposalHeight(), 2);
+  ASSERT_EQ(*state->loadPassedProposalHeight(), 0);
+  ASSERT_TRUE(state->loadTransactions().empty());
+}
+
+/**
+ * @given log with saved heights and transactions, one of them removed
+ * @when log is reopened
+ * @then the heights and not removed transactions are restored in order
+ */
+TEST_F(FileOrderingServicePersistentStateTest, StateIsRestoredAfterReopen) {
+  auto tx1 = makeTx(1), tx2 = makeTx(2), tx3 = makeTx(3);
+  {
+    auto state = open();
+    ASSERT_TRUE(state->saveProposalHeight(10));
+    ASSERT_TRUE(state->savePassedProposalHeight(7));
+    ASSERT_TRUE(state->saveTransaction(tx1));
+    ASSERT_TRUE(state->saveTransaction(tx2));
+    ASSERT_TRUE(state->saveTransaction(tx3));
+    ASSERT_TRUE(state->removeTransactions({tx2.hash()}));
+  }
+
+  auto state = open();
+  ASSERT_EQ(*state->loadProposalHeight(), 10);
+  ASSERT_EQ(*state->loadPassedProposalHeight(), 7);
+  auto transactions = state->loadTransactions();
+  ASSERT_EQ(transactions.size(), 2);
+  ASSERT_EQ(transactions[0]->hash(), tx1.hash());
+  ASSERT_EQ(transactions[1]->hash(), tx3.hash());
+}
+
+/**
+ * @given log with saved records and a torn record at the end
+ * @when log is reopened
+ * @then valid records are restored and the torn one is discarded,
+ * so new records can be appended after them
+ */
+TEST_F(FileOrderingServicePersistentStateTest, TornTailIsDiscarded) {
+  auto tx = makeTx(1);
+  {
+    auto state = open();
+    ASSERT_TRUE(state->saveProposalHeight(5));
+    ASSERT_TRUE(state->saveTransaction(tx));
+  }
+  auto size = fs::file_size(path);
+  {
+    std::ofstream file(path, std::ios::binary | std::ios::app);
+    file << std::string("\x20\x00\x00\x00\x02garbage", 12);
+  }
+
+  {
+    auto state = open();
+    ASSERT_EQ(*state->loadProposalHeight(), 5);
+    ASSERT_EQ(state->loadTransactions().size(), 1);
+    ASSERT_EQ(fs::file_size(path), size);
+    ASSERT_TRUE(state->saveProposalHeight(6));
+  }
+  ASSERT_EQ(*open()->loadProposalHeight(), 6);
+}
+
+/**
+ * @given log with saved records
+ * @when state is reset
+ * @then default height and no transactions are restored after reopen
+ */
+TEST_F(FileOrderingServicePersistentStateTest, ResetState) {
+  {
+    auto state = open();
+    ASSERT_TRUE(state->saveProposalHeight(10));
+    ASSERT_TRUE(state->savePassedProposalHeight(7));
+    ASSERT_TRUE(state->saveTransaction(makeTx(1)));
+    ASSERT_TRUE(state->resetState());
+  }
+
+  auto state = open();
+  ASSERT_EQ(*state->loadProposalHeight(), 2);
+  ASSERT_EQ(*state->loadPassedProposalHeight(), 0);
+  ASSERT_TRUE(state->loadTransactions().empty());
+}
+
+/**
+ * @given log
+ * @when transactions are saved concurrently by several threads
+ * @then all of them are restored after reopen
+ */
+TEST_F(FileOrderingServicePersistentStateTest, ConcurrentWritersShareSync) {
+  const size_t threads = 4, per_thread = 25;
+  {
+    auto state = open();
+    std::vector<std::thread> writers;
+    for (size_t i = 0; i < threads; ++i) {
+      writers.emplace_back([&, i] {
+        for (size_t j = 0; j < per_thread; ++j) {
+          EXPECT_TRUE(state->saveTransaction(makeTx(i * per_thread + j + 1)));
+        }
+      });
+    }
+    for (auto &writer : writers) {
+      writer.join();
+    }
+  }
+
+  ASSERT_EQ(open()->loadTransactions().size(), threads * per_thread);
+}
@@ -236,6 +236,37 @@ namespace iroha {
       EXPECT_FALSE(query->getAccountDetail("invalid account id"));
     }
 
+    /**
+     * @given inserted account with two signatories
+     * @when accounts and signatories are queried for the account and a
+     * non-existent one
+     * @then only the inserted account and its signatories are returned
+     */
+    TEST_F(AccountTest, GetAccountsAndSignatories) {
+      ASSERT_TRUE(val(command->insertAccount(*account)));
+      shared_model::interface::types::PubkeyType first(std::string(32, '1'));
+      shared_model::interface::types::PubkeyType second(std::string(32, '2'));
+      for (const auto &pubkey : {first, second}) {
+        ASSERT_TRUE(val(command->insertSignatory(pubkey)));
+        ASSERT_TRUE(val(
+            command->insertAccountSignatory(account->accountId(), pubkey)));
+      }
+      std::vector<std::string> ids{account->accountId(), "no@domain"};
+
+      auto accounts = query->getAccounts(ids);
+      ASSERT_TRUE(accounts);
+      ASSERT_EQ(1, accounts->size());
+      ASSERT_EQ(*account, *accounts->front());
+
+      auto signatories = query->getAccountsSignatories(ids);
+      ASSERT_TRUE(signatories);
+      ASSERT_EQ(2, signatories->size());
+      for (const auto &signatory : *signatories) {
+        ASSERT_EQ(account->accountId(), signatory.first);
+        ASSERT_TRUE(signatory.second == first or signatory.second == second);
+      }
+    }
+
     class AccountRoleTest : public WsvQueryCommandTest {
       void SetUp() override {
         WsvQueryCommandTest::SetUp();
@@ -20,6 +20,7 @@
 #include <grpc++/grpc++.h>
 
 #include "consensus/yac/transport/impl/network_impl.hpp"
+#include "consensus/yac/transport/yac_pb_converters.hpp"
 
 using ::testing::_;
 using ::testing::InvokeWithoutArgs;
@@ -90,6 +91,109 @@ namespace iroha {
         std::unique_lock<std::mutex> lock(mtx);
         cv.wait_for(lock, std::chrono::milliseconds(100));
       }
+
+      /**
+       * @given initialized network
+       * @when send commit of votes, whose block and vote are signed with the
+       * same key, to itself
+       * @then commit is received in compact form and equals the sent one
+       */
+      TEST_F(YacNetworkTest, CompactCommitHandled) {
+        auto vote = message;
+        vote.hash.block_signature = vote.signature;
+        CommitMessage commit({vote, vote});
+        EXPECT_CALL(*notifications, on_commit(commit))
+            .Times(1)
+            .WillRepeatedly(
+                InvokeWithoutArgs(&cv, &std::condition_variable::notify_one));
+
+        network->send_commit(*peer, commit);
+
+        // wait for response reader thread
+        std::unique_lock<std::mutex> lock(mtx);
+        cv.wait_for(lock, std::chrono::milliseconds(100));
+      }
+
+      /**
+       * @given commit of votes for the same hash signed with voters' keys
+       * @when it is serialized in compact form and deserialized back
+       * @then the result equals the commit
+       * AND compact form is smaller than list of full votes
+       */
+      TEST(YacPbConvertersTest, CompactCommitIsSmaller) {
+        std::vector<VoteMessage> votes;
+        for (auto i = 0; i < 4; ++i) {
+          auto vote = create_vote(YacHash(std::string(64, 'a'),
+                                          std::string(64, 'b')),
+                                  std::to_string(i));
+          vote.hash.block_signature = vote.signature;
+          votes.push_back(vote);
+        }
+        CommitMessage commit(votes);
+
+        auto compact = PbConverters::serializeCompactCommit(commit);
+        ASSERT_TRUE(compact);
+        auto restored = PbConverters::deserializeCompactCommit(*compact);
+        ASSERT_TRUE(restored);
+        ASSERT_EQ(commit, *restored);
+
+        proto::Commit full;
+        for (const auto &vote : votes) {
+          *full.add_votes() = PbConverters::serializeVote(vote);
+        }
+        ASSERT_LT(compact->ByteSize(), full.ByteSize());
+      }
+
+      /**
+       * @given commit of votes for different block hashes
+       * @when it is serialized in compact form
+       * @then serialization fails, so full votes are sent
+       */
+      TEST(YacPbConvertersTest, CompactCommitOfDifferentHashes) {
+        auto first = create_vote(YacHash("proposal", "block"), "0");
+        first.hash.block_signature = first.signature;
+        auto second = create_vote(YacHash("proposal", "other"), "1");
+        second.hash.block_signature = second.signature;
+
+        CommitMessage commit({first, second});
+
+        ASSERT_FALSE(PbConverters::serializeCompactCommit(commit));
+      }
+
+      /**
+       * @given vote for binary hashes
+       * @when it is serialized and deserialized back
+       * @then hashes are sent as hex strings, as by previous versions
+       * AND the result equals the vote
+       */
+      TEST(YacPbConvertersTest, HashesAreSentAsHex) {
+        auto vote = create_vote(
+            YacHash(std::string("\x01\xab", 2), std::string("\xff\x00", 2)),
+            "0");
+        vote.hash.block_signature = vote.signature;
+
+        auto pb_vote = PbConverters::serializeVote(vote);
+        ASSERT_EQ("01ab", pb_vote.hash().proposal());
+        ASSERT_EQ("ff00", pb_vote.hash().block());
+
+        auto restored = PbConverters::deserializeVote(pb_vote);
+        ASSERT_TRUE(restored);
+        ASSERT_EQ(vote, *restored);
+      }
+
+      /**
+       * @given serialized vote with a hash which is not a hex string
+       * @when it is deserialized
+       * @then deserialization fails
+       */
+      TEST(YacPbConvertersTest, VoteWithMalformedHash) {
+        auto vote = create_vote(YacHash("proposal", "block"), "0");
+        vote.hash.block_signature = vote.signature;
+        auto pb_vote = PbConverters::serializeVote(vote);
+        pb_vote.mutable_hash()->set_block("block");
+
+        ASSERT_FALSE(PbConverters::deserializeVote(pb_vote));
+      }
     }  // namespace yac
   }    // namespace consensus
 }  // namespace iroha
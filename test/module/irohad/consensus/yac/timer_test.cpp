@@ -24,8 +24,9 @@ using namespace iroha::consensus::yac;
 class TimerTest : public ::testing::Test {
  protected:
   void SetUp() override {
-    timer = std::make_shared<TimerImpl>(
-        [this] { return invoke_delay.get_observable(); });
+    wheel = std::make_shared<iroha::timer::TimerWheel>(
+        std::chrono::milliseconds(1));
+    timer = std::make_shared<TimerImpl>(wheel, std::chrono::milliseconds(1));
   }
 
   void TearDown() override {
@@ -33,11 +34,11 @@ class TimerTest : public ::testing::Test {
   }
 
   void invokeTimer() {
-    invoke_delay.get_subscriber().on_next(0);
+    wheel->tick();
   }
 
  public:
-  rxcpp::subjects::subject<TimerImpl::TimeoutType> invoke_delay;
+  std::shared_ptr<iroha::timer::TimerWheel> wheel;
   std::shared_ptr<Timer> timer;
 };
 
@@ -70,6 +70,35 @@ namespace iroha {
         ASSERT_FALSE(crypto_provider->verify(vote));
       }
 
+      /**
+       * @given votes of several peers for the same hash
+       * @when commit message with these votes is verified
+       * @then it is valid, and it becomes invalid when one of the votes is
+       * changed
+       */
+      TEST_F(YacCryptoProviderTest, CommitWithInvalidVote) {
+        YacHash hash("1", "1");
+        auto sig = shared_model::proto::SignatureBuilder()
+                       .publicKey(shared_model::crypto::PublicKey(pubkey))
+                       .signedData(shared_model::crypto::Signed(signed_data))
+                       .build();
+        hash.block_signature = clone(sig);
+
+        std::vector<VoteMessage> votes;
+        for (auto i = 0; i < 4; ++i) {
+          CryptoProviderImpl provider(shared_model::crypto::
+                                          DefaultCryptoAlgorithmType::
+                                              generateKeypair());
+          votes.push_back(provider.getVote(hash));
+        }
+
+        ASSERT_TRUE(crypto_provider->verify(CommitMessage(votes)));
+
+        votes[2].hash.block_hash = "hash changed";
+        ASSERT_FALSE(crypto_provider->verify(CommitMessage(votes)));
+        ASSERT_FALSE(crypto_provider->verify(RejectMessage(votes)));
+      }
+
     }  // namespace yac
   }    // namespace consensus
 }  // namespace iroha
@@ -40,6 +40,7 @@ using namespace std;
 using ::testing::_;
 using ::testing::An;
 using ::testing::AtLeast;
+using ::testing::Invoke;
 using ::testing::Return;
 
 class YacGateTest : public ::testing::Test {
@@ -209,7 +210,10 @@ TEST_F(YacGateTest, LoadBlockWhenDifferentCommit) {
   // load block
   auto sig = expected_block->signatures().begin();
   auto &pubkey = sig->publicKey();
-  EXPECT_CALL(*block_loader, retrieveBlock(pubkey, expected_block->hash()))
+  EXPECT_CALL(*block_loader,
+              retrieveBlock(std::vector<PublicKey>{pubkey},
+                            expected_block->hash(),
+                            YacGateImpl::kDefaultParallelRequests))
       .WillOnce(Return(expected_block));
 
   init();
@@ -270,7 +274,10 @@ TEST_F(YacGateTest, LoadBlockWhenDifferentCommitFailFirst) {
   // load block
   auto sig = expected_block->signatures().begin();
   auto &pubkey = sig->publicKey();
-  EXPECT_CALL(*block_loader, retrieveBlock(pubkey, expected_block->hash()))
+  EXPECT_CALL(*block_loader,
+              retrieveBlock(std::vector<PublicKey>{pubkey},
+                            expected_block->hash(),
+                            YacGateImpl::kDefaultParallelRequests))
       .WillOnce(Return(boost::none))
       .WillOnce(Return(expected_block));
 
@@ -289,3 +296,52 @@ TEST_F(YacGateTest, LoadBlockWhenDifferentCommitFailFirst) {
 
   ASSERT_TRUE(gate_wrapper.validate());
 }
+
+/**
+ * @given yac gate
+ * @when receives new commit different to the one it voted for from two voters
+ * @then the block is requested from both voters at once
+ */
+TEST_F(YacGateTest, LoadBlockFromAllVoters) {
+  EXPECT_CALL(*block_creator, on_block())
+      .WillOnce(Return(
+          rxcpp::observable<>::just<shared_model::interface::BlockVariant>(
+              expected_block)));
+  EXPECT_CALL(*hash_provider, makeHash(_)).WillOnce(Return(expected_hash));
+  EXPECT_CALL(*peer_orderer, getOrdering(_))
+      .WillOnce(Return(ClusterOrdering::create({mk_peer("fake_node")})));
+  EXPECT_CALL(*hash_gate, vote(expected_hash, _)).Times(1);
+
+  expected_hash = YacHash("actual_proposal", "actual_block");
+  message.hash = expected_hash;
+  auto other_message = message;
+  other_message.signature = createSig("other");
+
+  commit_message = CommitMessage({other_message, message});
+  expected_commit = rxcpp::observable<>::just(commit_message);
+  EXPECT_CALL(*hash_gate, on_commit()).WillOnce(Return(expected_commit));
+  EXPECT_CALL(*hash_provider, toModelHash(expected_hash))
+      .WillOnce(Return(expected_block->hash()));
+
+  EXPECT_CALL(*block_loader,
+              retrieveBlock(
+                  std::vector<PublicKey>{other_message.signature->publicKey(),
+                                         message.signature->publicKey()},
+                  expected_block->hash(),
+                  YacGateImpl::kDefaultParallelRequests))
+      .WillOnce(Return(expected_block));
+
+  init();
+
+  auto gate_wrapper = make_test_subscriber<CallExact>(gate->on_commit(), 1);
+  gate_wrapper.subscribe([this](const auto &block_variant) {
+    ASSERT_NO_THROW({
+      auto block = boost::apply_visitor(
+          framework::SpecifiedVisitor<decltype(expected_block)>(),
+          block_variant);
+      ASSERT_EQ(*block, *expected_block);
+    });
+  });
+
+  ASSERT_TRUE(gate_wrapper.validate());
+}
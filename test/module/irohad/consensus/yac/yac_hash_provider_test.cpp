@@ -31,12 +31,12 @@ TEST(YacHashProviderTest, MakeYacHashTest) {
   block.addSignature(shared_model::crypto::Signed("data"),
                      shared_model::crypto::PublicKey("key"));
 
-  auto hex_test_hash = block.hash().hex();
+  auto test_hash = shared_model::crypto::toBinaryString(block.hash());
 
   auto yac_hash = hash_provider.makeHash(block);
 
-  ASSERT_EQ(hex_test_hash, yac_hash.proposal_hash);
-  ASSERT_EQ(hex_test_hash, yac_hash.block_hash);
+  ASSERT_EQ(test_hash, yac_hash.proposal_hash);
+  ASSERT_EQ(test_hash, yac_hash.block_hash);
 }
 
 TEST(YacHashProviderTest, ToModelHashTest) {
@@ -101,3 +101,26 @@ TEST_F(YacProposalStorageTest, YacProposalStorageWhenRejectCase) {
   ASSERT_NE(boost::none, answer);
   ASSERT_EQ(6, boost::get<RejectMessage>(*answer).votes.size());
 }
+
+/**
+ * @given proposal storage with votes of several peers for one block
+ * @when the same peers and the rest of peers vote for another block
+ * @then votes for another block are counted and it gets the commit
+ */
+TEST_F(YacProposalStorageTest, VotesOfPeerForSeveralBlocksAreCounted) {
+  for (auto i = 0u; i < 4; ++i) {
+    ASSERT_EQ(boost::none, storage.insert(valid_votes.at(i)));
+  }
+
+  auto other_hash = YacHash(hash.proposal_hash, "other_commit");
+  for (auto i = 0u; i < 4; ++i) {
+    ASSERT_EQ(boost::none,
+              storage.insert(create_vote(other_hash, std::to_string(i))));
+  }
+
+  auto commit = storage.insert(create_vote(other_hash, "4"));
+  ASSERT_NE(boost::none, commit);
+  auto &votes = boost::get<CommitMessage>(*commit).votes;
+  ASSERT_EQ(5, votes.size());
+  ASSERT_EQ(other_hash, votes.front().hash);
+}
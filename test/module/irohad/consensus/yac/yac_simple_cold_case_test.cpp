@@ -17,9 +17,11 @@
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
+#include <condition_variable>
 #include <iostream>
 #include <memory>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -207,3 +209,36 @@ TEST_F(YacTest, PropagateCommitBeforeNotifyingSubscribersApplyReject) {
   // verify that on_commit subscribers are notified
   ASSERT_EQ(default_peers.size() + 1, messages.size());
 }
+
+/**
+ * @given yac consensus
+ * @when two votes are received from different threads at the same time
+ * @then their signatures are verified concurrently
+ */
+TEST_F(YacTest, VotesAreVerifiedConcurrently) {
+  std::mutex mutex;
+  std::condition_variable cv;
+  size_t verifying = 0;
+  std::vector<bool> concurrent;
+
+  EXPECT_CALL(*crypto, verify(An<VoteMessage>()))
+      .Times(2)
+      .WillRepeatedly(Invoke([&](VoteMessage) {
+        std::unique_lock<std::mutex> lock(mutex);
+        ++verifying;
+        cv.notify_all();
+        // waits for the other verification, which is possible only if
+        // verification does not hold the lock of yac
+        concurrent.push_back(cv.wait_for(
+            lock, std::chrono::seconds(5), [&] { return verifying == 2; }));
+        return true;
+      }));
+
+  YacHash hash("proposal", "block");
+  std::thread first([&] { yac->on_vote(create_vote(hash, "1")); });
+  std::thread second([&] { yac->on_vote(create_vote(hash, "2")); });
+  first.join();
+  second.join();
+
+  ASSERT_EQ(concurrent, std::vector<bool>({true, true}));
+}
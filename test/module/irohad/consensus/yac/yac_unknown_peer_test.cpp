@@ -22,6 +22,7 @@
 using ::testing::_;
 using ::testing::An;
 using ::testing::AtLeast;
+using ::testing::Invoke;
 using ::testing::Return;
 
 using namespace iroha::consensus::yac;
@@ -100,3 +101,55 @@ TEST_F(YacTest, UnknownVoteAfterCommit) {
   vote.signature = createSig(unknown);
   yac->on_vote(vote);
 }
+
+/**
+ * @given initialized yac which committed a hash
+ * @when the order is changed to another set of peers
+ * AND peers of the old and the new order vote for the committed hash
+ * @then commit is sent directly only to the peer of the new order
+ */
+TEST_F(YacTest, PeersAreFoundInNewOrder) {
+  auto old_order = ClusterOrdering::create(
+      {default_peers.begin(), default_peers.begin() + 4});
+  auto new_order = ClusterOrdering::create(
+      {default_peers.begin() + 3, default_peers.end()});
+  ASSERT_TRUE(old_order);
+  ASSERT_TRUE(new_order);
+
+  initYac(old_order.value());
+
+  EXPECT_CALL(*network, send_commit(_, _))
+      .WillOnce(Invoke([this](const auto &peer, const auto &) {
+        EXPECT_EQ(default_peers.at(4)->address(), peer.address());
+      }));
+  EXPECT_CALL(*network, send_reject(_, _)).Times(0);
+  EXPECT_CALL(*network, send_vote(_, _)).Times(0);
+
+  EXPECT_CALL(*timer, deny()).Times(AtLeast(1));
+
+  EXPECT_CALL(*crypto, verify(An<CommitMessage>())).WillOnce(Return(true));
+  EXPECT_CALL(*crypto, verify(An<VoteMessage>()))
+      .Times(2)
+      .WillRepeatedly(Return(true));
+
+  YacHash my_hash("proposal_hash", "block_hash");
+  auto peer_vote = [&my_hash](const auto &peer) {
+    VoteMessage vote;
+    vote.hash = my_hash;
+    vote.signature =
+        clone(TestSignatureBuilder().publicKey(peer->pubkey()).build());
+    return vote;
+  };
+
+  std::vector<VoteMessage> votes;
+  for (auto i = 0; i < 3; ++i) {
+    votes.push_back(peer_vote(default_peers.at(i)));
+  }
+  yac->on_commit(CommitMessage(votes));
+
+  // the hash is committed, so no votes are sent
+  yac->vote(my_hash, new_order.value());
+
+  yac->on_vote(peer_vote(default_peers.at(0)));
+  yac->on_vote(peer_vote(default_peers.at(4)));
+}
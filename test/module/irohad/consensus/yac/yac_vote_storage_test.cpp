@@ -0,0 +1,98 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <gtest/gtest.h>
+
+#include "consensus/yac/storage/yac_vote_storage.hpp"
+#include "module/irohad/consensus/yac/yac_mocks.hpp"
+
+using namespace iroha::consensus::yac;
+
+class YacVoteStorageTest : public ::testing::Test {
+ public:
+  /**
+   * Insert votes of all peers for given proposal
+   * @return answer of storage after the last vote
+   */
+  boost::optional<Answer> decideRound(YacVoteStorage &storage,
+                                      const std::string &proposal) {
+    boost::optional<Answer> answer;
+    for (auto i = 0u; i < number_of_peers; ++i) {
+      answer = storage.store(
+          create_vote(YacHash(proposal, "block"), std::to_string(i)),
+          number_of_peers);
+    }
+    return answer;
+  }
+
+  const uint64_t number_of_peers = 4;
+};
+
+/**
+ * @given vote storage retaining two decided rounds
+ * @when three rounds are decided
+ * @then the first round is evicted with its processing state
+ */
+TEST_F(YacVoteStorageTest, OldRoundsAreEvicted) {
+  YacVoteStorage storage(2);
+
+  ASSERT_NE(boost::none, decideRound(storage, "1"));
+  storage.markAsProcessedState("1");
+  ASSERT_NE(boost::none, decideRound(storage, "2"));
+  ASSERT_EQ(2, storage.getNumberOfRounds());
+  ASSERT_TRUE(storage.isHashCommitted("1"));
+
+  ASSERT_NE(boost::none, decideRound(storage, "3"));
+  ASSERT_EQ(2, storage.getNumberOfRounds());
+  ASSERT_FALSE(storage.isHashCommitted("1"));
+  ASSERT_FALSE(storage.getProcessingState("1"));
+  ASSERT_TRUE(storage.isHashCommitted("2"));
+  ASSERT_TRUE(storage.isHashCommitted("3"));
+}
+
+/**
+ * @given vote storage retaining one decided round
+ * @when a round is started, then a newer round is decided twice
+ * @then the undecided older round is evicted together with decided ones
+ */
+TEST_F(YacVoteStorageTest, UndecidedOldRoundsAreEvicted) {
+  YacVoteStorage storage(1);
+
+  ASSERT_EQ(boost::none,
+            storage.store(create_vote(YacHash("1", "block"), "0"),
+                          number_of_peers));
+  ASSERT_NE(boost::none, decideRound(storage, "2"));
+  ASSERT_EQ(2, storage.getNumberOfRounds());
+
+  ASSERT_NE(boost::none, decideRound(storage, "3"));
+  ASSERT_EQ(1, storage.getNumberOfRounds());
+  ASSERT_TRUE(storage.isHashCommitted("3"));
+}
+
+/**
+ * @given vote storage retaining two decided rounds
+ * @when three rounds are decided and commit of the first round is replayed
+ * @then the commit is dropped and the evicted round is not decided again
+ */
+TEST_F(YacVoteStorageTest, EvictedRoundIsNotDecidedAgain) {
+  YacVoteStorage storage(2);
+
+  std::vector<VoteMessage> votes;
+  for (auto i = 0u; i < number_of_peers; ++i) {
+    votes.push_back(create_vote(YacHash("1", "block"), std::to_string(i)));
+  }
+  ASSERT_NE(boost::none,
+            storage.store(CommitMessage(votes), number_of_peers));
+  storage.markAsProcessedState("1");
+  ASSERT_NE(boost::none, decideRound(storage, "2"));
+  ASSERT_NE(boost::none, decideRound(storage, "3"));
+  ASSERT_FALSE(storage.isHashCommitted("1"));
+
+  ASSERT_EQ(boost::none,
+            storage.store(CommitMessage(votes), number_of_peers));
+  ASSERT_EQ(boost::none, storage.store(votes.front(), number_of_peers));
+  ASSERT_EQ(2, storage.getNumberOfRounds());
+  ASSERT_FALSE(storage.isHashCommitted("1"));
+}
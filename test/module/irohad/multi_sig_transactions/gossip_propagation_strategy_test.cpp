@@ -58,6 +58,15 @@ PropagationData generate(std::vector<std::string> &ids, size_t num) {
   return peers;
 }
 
+/**
+ * @return started timer service with resolution of one millisecond
+ */
+std::shared_ptr<iroha::timer::TimerWheel> makeTimerWheel() {
+  auto wheel = std::make_shared<iroha::timer::TimerWheel>(1ms);
+  wheel->start();
+  return wheel;
+}
+
 /**
  * Perform subscription and the emitting from specified strategy
  * @param strategy is emitter source
@@ -89,7 +98,7 @@ PropagationData subscribeAndEmit(boost::optional<PropagationData> data,
                                  uint32_t take) {
   auto query = std::make_shared<MockPeerQuery>();
   EXPECT_CALL(*query, getLedgerPeers()).WillRepeatedly(testing::Return(data));
-  GossipPropagationStrategy strategy(query, period, amount);
+  GossipPropagationStrategy strategy(query, period, amount, makeTimerWheel());
   return subscribeAndEmit(strategy, take);
 }
 
@@ -192,7 +201,7 @@ TEST(GossipPropagationStrategyTest, MultipleSubsEmission) {
 
   auto query = std::make_shared<MockPeerQuery>();
   EXPECT_CALL(*query, getLedgerPeers()).WillRepeatedly(testing::Return(peers));
-  GossipPropagationStrategy strategy(query, 1ms, amount);
+  GossipPropagationStrategy strategy(query, 1ms, amount, makeTimerWheel());
 
   // Create separate subscriber for every thread
   // Use result[i] as storage for emitent for i-th one
@@ -19,6 +19,8 @@
 #include <grpc++/server.h>
 #include <grpc++/server_builder.h>
 #include <gtest/gtest.h>
+#include <future>
+#include <thread>
 
 #include "backend/protobuf/block.hpp"
 #include "backend/protobuf/common_objects/peer.hpp"
@@ -40,11 +42,28 @@ using namespace iroha::ametsuchi;
 using namespace framework::test_subscriber;
 using namespace shared_model::crypto;
 
+using testing::_;
 using testing::A;
+using testing::Invoke;
 using testing::Return;
 
 using wPeer = std::shared_ptr<shared_model::interface::Peer>;
 using wBlock = std::shared_ptr<shared_model::interface::Block>;
+using wBlockTransport = std::shared_ptr<iroha::protocol::Block>;
+
+/**
+ * @return observable of stored blocks in transport format
+ */
+rxcpp::observable<wBlockTransport> toTransports(
+    const std::vector<wBlock> &blocks) {
+  std::vector<wBlockTransport> transports;
+  for (const auto &block : blocks) {
+    transports.push_back(std::make_shared<iroha::protocol::Block>(
+        std::static_pointer_cast<shared_model::proto::Block>(block)
+            ->getTransport()));
+  }
+  return rxcpp::observable<>::iterate(transports);
+}
 
 class BlockLoaderTest : public testing::Test {
  public:
@@ -117,8 +136,8 @@ TEST_F(BlockLoaderTest, ValidWhenSameTopBlock) {
       .WillOnce(Return(std::vector<wPeer>{peer}));
   EXPECT_CALL(*storage, getTopBlock())
       .WillOnce(Return(iroha::expected::makeValue(wBlock(clone(block)))));
-  EXPECT_CALL(*storage, getBlocksFrom(block.height() + 1))
-      .WillOnce(Return(rxcpp::observable<>::empty<wBlock>()));
+  EXPECT_CALL(*storage, getBlockTransports(block.height() + 1, _))
+      .WillOnce(Return(rxcpp::observable<>::empty<wBlockTransport>()));
   auto wrapper = make_test_subscriber<CallExact>(
       loader->retrieveBlocks(peer->pubkey()), 0);
   wrapper.subscribe();
@@ -141,9 +160,8 @@ TEST_F(BlockLoaderTest, ValidWhenOneBlock) {
       .WillOnce(Return(std::vector<wPeer>{peer}));
   EXPECT_CALL(*storage, getTopBlock())
       .WillOnce(Return(iroha::expected::makeValue(wBlock(clone(block)))));
-  EXPECT_CALL(*storage, getBlocksFrom(block.height() + 1))
-      .WillOnce(Return(rxcpp::observable<>::just(top_block).map(
-          [](auto &&x) { return wBlock(clone(x)); })));
+  EXPECT_CALL(*storage, getBlockTransports(block.height() + 1, _))
+      .WillOnce(Return(toTransports({wBlock(clone(top_block))})));
   auto wrapper =
       make_test_subscriber<CallExact>(loader->retrieveBlocks(peer_key), 1);
   wrapper.subscribe(
@@ -174,8 +192,40 @@ TEST_F(BlockLoaderTest, ValidWhenMultipleBlocks) {
       .WillOnce(Return(std::vector<wPeer>{peer}));
   EXPECT_CALL(*storage, getTopBlock())
       .WillOnce(Return(iroha::expected::makeValue(wBlock(clone(block)))));
-  EXPECT_CALL(*storage, getBlocksFrom(next_height))
-      .WillOnce(Return(rxcpp::observable<>::iterate(blocks)));
+  EXPECT_CALL(*storage, getBlockTransports(next_height, _))
+      .WillOnce(Return(toTransports(blocks)));
+  auto wrapper = make_test_subscriber<CallExact>(
+      loader->retrieveBlocks(peer_key), num_blocks);
+  auto height = next_height;
+  wrapper.subscribe(
+      [&height](auto block) { ASSERT_EQ(block->height(), height++); });
+
+  ASSERT_TRUE(wrapper.validate());
+}
+
+/**
+ * @given block loader, a block, and more additional blocks than validated
+ * at once
+ * @when retrieveBlocks is called
+ * @then all blocks are validated and returned in order of heights
+ */
+TEST_F(BlockLoaderTest, ValidatedBlocksKeepOrder) {
+  auto block = getBaseBlockBuilder().build();
+
+  const auto num_blocks = 4 * std::thread::hardware_concurrency() + 3;
+  auto next_height = block.height() + 1;
+
+  std::vector<wBlock> blocks;
+  for (auto i = next_height; i < next_height + num_blocks; ++i) {
+    blocks.emplace_back(clone(getBaseBlockBuilder().height(i).build()));
+  }
+
+  EXPECT_CALL(*peer_query, getLedgerPeers())
+      .WillOnce(Return(std::vector<wPeer>{peer}));
+  EXPECT_CALL(*storage, getTopBlock())
+      .WillOnce(Return(iroha::expected::makeValue(wBlock(clone(block)))));
+  EXPECT_CALL(*storage, getBlockTransports(next_height, _))
+      .WillOnce(Return(toTransports(blocks)));
   auto wrapper = make_test_subscriber<CallExact>(
       loader->retrieveBlocks(peer_key), num_blocks);
   auto height = next_height;
@@ -223,3 +273,211 @@ TEST_F(BlockLoaderTest, ValidWhenBlockMissing) {
 
   ASSERT_FALSE(block);
 }
+
+/**
+ * @given block loader with range size of 2 blocks, block 1 stored, and two
+ * peers with blocks 2-7, where the first peer fails to provide blocks 4-5
+ * @when retrieveChain is called for both peers up to height 7
+ * @then blocks 2-7 are returned in order
+ * AND the failed range is retrieved from the second peer
+ */
+TEST_F(BlockLoaderTest, ChainIsSplitBetweenPeers) {
+  auto block = getBaseBlockBuilder().build();
+  const shared_model::interface::types::HeightType target_height = 7;
+
+  auto second_storage = std::make_shared<MockBlockQuery>();
+  BlockLoaderService second_service(second_storage);
+  grpc::ServerBuilder builder;
+  int port = 0;
+  builder.AddListeningPort(
+      "0.0.0.0:0", grpc::InsecureServerCredentials(), &port);
+  builder.RegisterService(&second_service);
+  auto second_server = builder.BuildAndStart();
+  ASSERT_TRUE(second_server);
+  auto second_key = DefaultCryptoAlgorithmType::generateKeypair().publicKey();
+  wPeer second_peer = clone(shared_model::proto::PeerBuilder()
+                                .address("0.0.0.0:" + std::to_string(port))
+                                .pubkey(second_key)
+                                .build());
+
+  auto make_blocks = [this](auto height, auto count) {
+    std::vector<wBlock> blocks;
+    for (auto i = height; i < height + count; ++i) {
+      blocks.emplace_back(clone(getBaseBlockBuilder().height(i).build()));
+    }
+    return toTransports(blocks);
+  };
+  EXPECT_CALL(*storage, getBlockTransports(_, 2))
+      .WillRepeatedly(Invoke([&](auto height, auto count) {
+        return height == 4 ? toTransports({}) : make_blocks(height, count);
+      }));
+  EXPECT_CALL(*second_storage, getBlockTransports(_, 2))
+      .WillRepeatedly(Invoke(make_blocks));
+  EXPECT_CALL(*peer_query, getLedgerPeers())
+      .WillRepeatedly(Return(std::vector<wPeer>{peer, second_peer}));
+  EXPECT_CALL(*storage, getTopBlock())
+      .WillOnce(Return(iroha::expected::makeValue(wBlock(clone(block)))));
+
+  auto range_loader = std::make_shared<BlockLoaderImpl>(
+      peer_query,
+      storage,
+      std::make_shared<shared_model::validation::DefaultBlockValidator>(),
+      BlockLoaderImpl::kDefaultRequestTimeout,
+      2);
+  auto wrapper = make_test_subscriber<CallExact>(
+      range_loader->retrieveChain({peer_key, second_key}, target_height),
+      target_height - block.height());
+  auto height = block.height() + 1;
+  wrapper.subscribe(
+      [&height](auto block) { ASSERT_EQ(block->height(), height++); });
+
+  ASSERT_TRUE(wrapper.validate());
+  second_server->Shutdown();
+}
+
+/**
+ * @given storage with block 3 on top
+ * @when retrieveChain is called up to height 3
+ * @then nothing is requested and the observable completes empty
+ */
+TEST_F(BlockLoaderTest, ChainIsEmptyWhenTargetReached) {
+  auto block = getBaseBlockBuilder().height(3).build();
+
+  EXPECT_CALL(*peer_query, getLedgerPeers())
+      .WillRepeatedly(Return(std::vector<wPeer>{peer}));
+  EXPECT_CALL(*storage, getTopBlock())
+      .WillOnce(Return(iroha::expected::makeValue(wBlock(clone(block)))));
+  EXPECT_CALL(*storage, getBlockTransports(_, _)).Times(0);
+
+  auto wrapper =
+      make_test_subscriber<CallExact>(loader->retrieveChain({peer_key}, 3), 0);
+  wrapper.subscribe();
+
+  ASSERT_TRUE(wrapper.validate());
+}
+
+/**
+ * @given block loader with range size of 2 blocks and request timeout of
+ * 100 ms, block 1 stored, and two peers with blocks 2-5, where the first peer
+ * hangs on the range 4-5
+ * @when retrieveChain is called for both peers up to height 5
+ * @then blocks 2-5 are returned in order
+ * AND the range is retrieved from the second peer after the timeout
+ */
+TEST_F(BlockLoaderTest, HangingRangeIsRetriedFromOtherPeer) {
+  auto block = getBaseBlockBuilder().build();
+  const shared_model::interface::types::HeightType target_height = 5;
+
+  auto second_storage = std::make_shared<MockBlockQuery>();
+  BlockLoaderService second_service(second_storage);
+  grpc::ServerBuilder builder;
+  int port = 0;
+  builder.AddListeningPort(
+      "0.0.0.0:0", grpc::InsecureServerCredentials(), &port);
+  builder.RegisterService(&second_service);
+  auto second_server = builder.BuildAndStart();
+  ASSERT_TRUE(second_server);
+  auto second_key = DefaultCryptoAlgorithmType::generateKeypair().publicKey();
+  wPeer second_peer = clone(shared_model::proto::PeerBuilder()
+                                .address("0.0.0.0:" + std::to_string(port))
+                                .pubkey(second_key)
+                                .build());
+
+  auto make_blocks = [this](auto height, auto count) {
+    std::vector<wBlock> blocks;
+    for (auto i = height; i < height + count; ++i) {
+      blocks.emplace_back(clone(getBaseBlockBuilder().height(i).build()));
+    }
+    return toTransports(blocks);
+  };
+  // the hanging range is released when the test is over
+  std::promise<void> release;
+  auto released = release.get_future().share();
+  EXPECT_CALL(*storage, getBlockTransports(_, 2))
+      .WillRepeatedly(Invoke([&, released](auto height, auto count)
+                                 -> rxcpp::observable<wBlockTransport> {
+        if (height != 4) {
+          return make_blocks(height, count);
+        }
+        return rxcpp::observable<>::create<wBlockTransport>(
+            [released](auto subscriber) {
+              released.wait_for(std::chrono::seconds(10));
+              subscriber.on_completed();
+            });
+      }));
+  EXPECT_CALL(*second_storage, getBlockTransports(_, 2))
+      .WillRepeatedly(Invoke(make_blocks));
+  EXPECT_CALL(*peer_query, getLedgerPeers())
+      .WillRepeatedly(Return(std::vector<wPeer>{peer, second_peer}));
+  EXPECT_CALL(*storage, getTopBlock())
+      .WillOnce(Return(iroha::expected::makeValue(wBlock(clone(block)))));
+
+  auto range_loader = std::make_shared<BlockLoaderImpl>(
+      peer_query,
+      storage,
+      std::make_shared<shared_model::validation::DefaultBlockValidator>(),
+      std::chrono::milliseconds(100),
+      2);
+  auto wrapper = make_test_subscriber<CallExact>(
+      range_loader->retrieveChain({peer_key, second_key}, target_height),
+      target_height - block.height());
+  auto height = block.height() + 1;
+  auto start = std::chrono::steady_clock::now();
+  wrapper.subscribe(
+      [&height](auto block) { ASSERT_EQ(block->height(), height++); });
+
+  ASSERT_TRUE(wrapper.validate());
+  ASSERT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(5));
+  release.set_value();
+  second_server->Shutdown();
+}
+
+/**
+ * @given two peers with the same block, where the first peer hangs
+ * @when retrieveBlock is called for both peers with the block hash
+ * @then the block is returned from the second peer without waiting for the
+ * request timeout of the first one
+ */
+TEST_F(BlockLoaderTest, BlockIsLoadedWhenFirstPeerHangs) {
+  auto requested = getBaseBlockBuilder().build();
+
+  auto second_storage = std::make_shared<MockBlockQuery>();
+  BlockLoaderService second_service(second_storage);
+  grpc::ServerBuilder builder;
+  int port = 0;
+  builder.AddListeningPort(
+      "0.0.0.0:0", grpc::InsecureServerCredentials(), &port);
+  builder.RegisterService(&second_service);
+  auto second_server = builder.BuildAndStart();
+  ASSERT_TRUE(second_server);
+  auto second_key = DefaultCryptoAlgorithmType::generateKeypair().publicKey();
+  wPeer second_peer = clone(shared_model::proto::PeerBuilder()
+                                .address("0.0.0.0:" + std::to_string(port))
+                                .pubkey(second_key)
+                                .build());
+
+  // the hanging request is released when the test is over
+  std::promise<void> release;
+  auto released = release.get_future().share();
+  EXPECT_CALL(*storage, getBlocksFrom(1))
+      .WillOnce(Return(rxcpp::observable<>::create<wBlock>(
+          [released](auto subscriber) {
+            released.wait_for(std::chrono::seconds(10));
+            subscriber.on_completed();
+          })));
+  EXPECT_CALL(*second_storage, getBlocksFrom(1))
+      .WillOnce(Return(rxcpp::observable<>::just(requested).map(
+          [](auto &&x) { return wBlock(clone(x)); })));
+  EXPECT_CALL(*peer_query, getLedgerPeers())
+      .WillRepeatedly(Return(std::vector<wPeer>{peer, second_peer}));
+
+  auto start = std::chrono::steady_clock::now();
+  auto block =
+      loader->retrieveBlock({peer_key, second_key}, requested.hash(), 2);
+
+  ASSERT_TRUE(block);
+  ASSERT_EQ(**block, requested);
+  ASSERT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(5));
+  release.set_value();
+  second_server->Shutdown();
+}
@@ -44,6 +44,10 @@ namespace iroha {
               std::shared_ptr<shared_model::interface::Proposal>>());
 
       MOCK_CONST_METHOD0(on_commit, rxcpp::observable<Commit>());
+
+      MOCK_CONST_METHOD0(
+          on_rejected_transaction,
+          rxcpp::observable<shared_model::interface::types::HashType>());
     };
 
     class MockBlockLoader : public BlockLoader {
@@ -52,11 +56,22 @@ namespace iroha {
           retrieveBlocks,
           rxcpp::observable<std::shared_ptr<shared_model::interface::Block>>(
               const shared_model::crypto::PublicKey &));
+      MOCK_METHOD2(
+          retrieveChain,
+          rxcpp::observable<std::shared_ptr<shared_model::interface::Block>>(
+              const std::vector<shared_model::crypto::PublicKey> &,
+              shared_model::interface::types::HeightType));
       MOCK_METHOD2(
           retrieveBlock,
           boost::optional<std::shared_ptr<shared_model::interface::Block>>(
               const shared_model::crypto::PublicKey &,
               const shared_model::interface::types::HashType &));
+      MOCK_METHOD3(
+          retrieveBlock,
+          boost::optional<std::shared_ptr<shared_model::interface::Block>>(
+              const std::vector<shared_model::crypto::PublicKey> &,
+              const shared_model::interface::types::HashType &,
+              size_t));
     };
 
     class MockOrderingGate : public OrderingGate {
@@ -70,6 +85,16 @@ namespace iroha {
                    rxcpp::observable<
                        std::shared_ptr<shared_model::interface::Proposal>>());
 
+      MOCK_METHOD0(on_speculative_proposal,
+                   rxcpp::observable<
+                       std::shared_ptr<shared_model::interface::Proposal>>());
+
+      MOCK_METHOD0(
+          on_rejected_transaction,
+          rxcpp::observable<shared_model::interface::types::HashType>());
+
+      MOCK_METHOD1(skipRound, void(shared_model::interface::types::HeightType));
+
       MOCK_METHOD1(setPcs, void(const PeerCommunicationService &));
     };
 
@@ -0,0 +1,138 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+#include "ordering/impl/creator_fair_queue.hpp"
+
+using namespace iroha::ordering;
+
+class CreatorFairQueueTest : public ::testing::Test {
+ public:
+  std::vector<int> popAll() {
+    std::vector<int> result;
+    for (int value; queue.try_pop(value);) {
+      result.push_back(value);
+    }
+    return result;
+  }
+
+  CreatorFairQueue<int> queue;
+};
+
+/**
+ * @given empty queue
+ * @when try_pop is called
+ * @then nothing is popped
+ */
+TEST_F(CreatorFairQueueTest, EmptyQueue) {
+  int value;
+  ASSERT_TRUE(queue.empty());
+  ASSERT_FALSE(queue.try_pop(value));
+}
+
+/**
+ * @given queue with elements of one creator
+ * @when all elements are popped
+ * @then they are popped in FIFO order
+ */
+TEST_F(CreatorFairQueueTest, SingleCreatorIsFifo) {
+  for (int i = 0; i < 5; ++i) {
+    queue.push("a", i);
+  }
+  ASSERT_EQ(queue.size(), 5);
+  ASSERT_EQ(popAll(), std::vector<int>({0, 1, 2, 3, 4}));
+  ASSERT_TRUE(queue.empty());
+}
+
+/**
+ * @given queue with burst of elements from creator "heavy"
+ *        followed by single elements from creators "b" and "c"
+ * @when all elements are popped
+ * @then creators are served in round-robin order
+ */
+TEST_F(CreatorFairQueueTest, CreatorsAreServedInRoundRobin) {
+  for (int i = 0; i < 4; ++i) {
+    queue.push("heavy", i);
+  }
+  queue.push("b", 10);
+  queue.push("c", 20);
+  ASSERT_EQ(queue.readyCreators(), 3);
+
+  ASSERT_EQ(popAll(), std::vector<int>({0, 10, 20, 1, 2, 3}));
+}
+
+/**
+ * @given queue which was drained
+ * @when the same creator pushes again
+ * @then element is popped
+ */
+TEST_F(CreatorFairQueueTest, CreatorBecomesReadyAgain) {
+  queue.push("a", 1);
+  ASSERT_EQ(popAll(), std::vector<int>({1}));
+  queue.push("a", 2);
+  ASSERT_EQ(popAll(), std::vector<int>({2}));
+}
+
+/**
+ * @given queue
+ * @when several threads push and pop concurrently
+ * @then every pushed element is popped exactly once
+ */
+TEST_F(CreatorFairQueueTest, ConcurrentPushPop) {
+  const int kThreads = 4;
+  const int kPerThread = 10000;
+  std::atomic<int> popped{0};
+  std::vector<std::atomic<int>> seen(kThreads * kPerThread);
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&, t] {
+      for (int i = 0; i < kPerThread; ++i) {
+        queue.push(std::to_string(i % 7), t * kPerThread + i);
+      }
+    });
+    threads.emplace_back([&] {
+      int value;
+      while (popped.load() < kThreads * kPerThread) {
+        if (queue.try_pop(value)) {
+          ++seen[value];
+          ++popped;
+        }
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  ASSERT_TRUE(queue.empty());
+  ASSERT_EQ(queue.trackedCreators(), 0);
+  for (const auto &count : seen) {
+    ASSERT_EQ(count.load(), 1);
+  }
+}
+
+/**
+ * @given queue with elements of many distinct creators
+ * @when all elements are popped
+ * @then no creator is tracked anymore
+ * AND a creator pushing again is served
+ */
+TEST_F(CreatorFairQueueTest, DrainedCreatorsAreForgotten) {
+  for (int i = 0; i < 100; ++i) {
+    queue.push("creator" + std::to_string(i), i);
+  }
+  ASSERT_EQ(queue.trackedCreators(), 100);
+
+  ASSERT_EQ(popAll().size(), 100);
+  ASSERT_EQ(queue.trackedCreators(), 0);
+
+  queue.push("creator0", 0);
+  ASSERT_EQ(queue.trackedCreators(), 1);
+  ASSERT_EQ(popAll(), std::vector<int>({0}));
+}
@@ -0,0 +1,232 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <gtest/gtest.h>
+#include <thread>
+
+#include "cryptography/default_hash_provider.hpp"
+#include "module/irohad/ametsuchi/ametsuchi_mocks.hpp"
+#include "module/shared_model/builders/protobuf/test_block_builder.hpp"
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+#include "ordering/impl/duplicate_filter.hpp"
+
+using namespace iroha::ordering;
+using namespace iroha::ametsuchi;
+using namespace std::chrono_literals;
+
+using ::testing::_;
+using ::testing::Return;
+
+/**
+ * @return hash of given number, padded to the length of sha3-256 hash
+ */
+shared_model::crypto::Hash makeHash(size_t i) {
+  auto str = std::to_string(i);
+  return shared_model::crypto::Hash(str + std::string(32 - str.size(), '#'));
+}
+
+/**
+ * @given Bloom filter with capacity N
+ * @when N hashes are added
+ * @then all added hashes are reported, and false positive rate of other
+ * hashes is close to the expected 1%
+ */
+TEST(TxHashBloomFilterTest, NoFalseNegativesAndFewFalsePositives) {
+  const size_t capacity = 10000;
+  TxHashBloomFilter filter(capacity);
+  for (size_t i = 0; i < capacity; ++i) {
+    filter.add(shared_model::crypto::DefaultHashProvider::makeHash(
+                   shared_model::crypto::Blob(std::to_string(i)))
+                   .blob());
+  }
+  ASSERT_EQ(filter.size(), capacity);
+
+  size_t false_positives = 0;
+  for (size_t i = 0; i < capacity; ++i) {
+    ASSERT_TRUE(
+        filter.mayContain(shared_model::crypto::DefaultHashProvider::makeHash(
+                              shared_model::crypto::Blob(std::to_string(i)))
+                              .blob()));
+    false_positives += filter.mayContain(
+        shared_model::crypto::DefaultHashProvider::makeHash(
+            shared_model::crypto::Blob(std::to_string(capacity + i)))
+            .blob());
+  }
+  ASSERT_LT(false_positives, capacity * 2 / 100);
+}
+
+class DuplicateFilterTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    block_query = std::make_shared<MockBlockQuery>();
+  }
+
+  auto initFilter(std::vector<shared_model::crypto::Hash> committed = {},
+                  std::chrono::milliseconds ttl = 1min) {
+    EXPECT_CALL(*block_query, getTxHashesFrom(1))
+        .WillOnce(Return(committed));
+    return std::make_shared<DuplicateFilter>(
+        block_query, commits.get_observable(), ttl);
+  }
+
+  std::shared_ptr<MockBlockQuery> block_query;
+  rxcpp::subjects::subject<std::shared_ptr<shared_model::interface::Block>>
+      commits;
+};
+
+/**
+ * @given empty duplicate filter
+ * @when the same hash is inserted twice
+ * @then the first insertion succeeds and the second one fails
+ */
+TEST_F(DuplicateFilterTest, PendingDuplicateIsDetected) {
+  auto filter = initFilter();
+  EXPECT_CALL(*block_query, hasTxWithHash(_)).Times(0);
+
+  ASSERT_TRUE(filter->insert(makeHash(1)));
+  ASSERT_FALSE(filter->insert(makeHash(1)));
+  ASSERT_TRUE(filter->insert(makeHash(2)));
+  ASSERT_EQ(filter->pendingSize(), 2);
+}
+
+/**
+ * @given duplicate filter with pending hash
+ * @when the hash is erased
+ * @then it can be inserted again
+ */
+TEST_F(DuplicateFilterTest, ErasedHashCanBeInsertedAgain) {
+  auto filter = initFilter();
+
+  ASSERT_TRUE(filter->insert(makeHash(1)));
+  filter->erase(makeHash(1));
+  ASSERT_TRUE(filter->insert(makeHash(1)));
+}
+
+/**
+ * @given duplicate filter with short ttl and pending hash
+ * @when the ttl passes
+ * @then the hash can be inserted again
+ */
+TEST_F(DuplicateFilterTest, PendingHashExpires) {
+  auto filter = initFilter({}, 1ms);
+
+  ASSERT_TRUE(filter->insert(makeHash(1)));
+  std::this_thread::sleep_for(10ms);
+  ASSERT_TRUE(filter->insert(makeHash(1)));
+}
+
+/**
+ * @given duplicate filter seeded with committed hash
+ * @when the hash is inserted and block storage confirms it is committed
+ * @then the insertion fails
+ */
+TEST_F(DuplicateFilterTest, CommittedDuplicateIsDetected) {
+  auto filter = initFilter({makeHash(1)});
+  EXPECT_CALL(*block_query, hasTxWithHash(makeHash(1)))
+      .WillOnce(Return(true));
+
+  ASSERT_FALSE(filter->insert(makeHash(1)));
+}
+
+/**
+ * @given duplicate filter with Bloom filter reporting a hash
+ * @when block storage does not confirm the hash is committed
+ * @then the insertion succeeds
+ */
+TEST_F(DuplicateFilterTest, BloomFalsePositiveIsNotDropped) {
+  auto filter = initFilter({makeHash(1)});
+  EXPECT_CALL(*block_query, hasTxWithHash(makeHash(1)))
+      .WillOnce(Return(false));
+
+  ASSERT_TRUE(filter->insert(makeHash(1)));
+  ASSERT_EQ(filter->pendingSize(), 1);
+}
+
+/**
+ * @given duplicate filter with pending transaction
+ * @when block with the transaction is committed
+ * @then the transaction is not pending anymore
+ * and its next insertion fails as committed
+ */
+TEST_F(DuplicateFilterTest, CommittedTransactionMovesFromPending) {
+  auto filter = initFilter();
+  auto tx = TestTransactionBuilder().creatorAccountId("admin@test").build();
+  auto block = std::make_shared<shared_model::proto::Block>(
+      TestBlockBuilder()
+          .height(2)
+          .transactions(std::vector<shared_model::proto::Transaction>({tx}))
+          .build());
+  EXPECT_CALL(*block_query, hasTxWithHash(tx.hash())).WillOnce(Return(true));
+
+  ASSERT_TRUE(filter->insert(tx.hash()));
+  commits.get_subscriber().on_next(block);
+  ASSERT_EQ(filter->pendingSize(), 0);
+  ASSERT_FALSE(filter->insert(tx.hash()));
+}
+
+/**
+ * @given duplicate filter with Bloom filter of minimal capacity
+ * @when more transactions are committed than the capacity
+ * @then Bloom filter is rebuilt from block storage
+ */
+TEST_F(DuplicateFilterTest, BloomFilterIsRebuiltWhenFull) {
+  EXPECT_CALL(*block_query, getTxHashesFrom(1))
+      .Times(2)
+      .WillRepeatedly(Return(std::vector<shared_model::crypto::Hash>{}));
+  auto filter = std::make_shared<DuplicateFilter>(
+      block_query, commits.get_observable(), 1min, 1);
+
+  for (auto i = 0; i < 2; ++i) {
+    auto tx = TestTransactionBuilder().createdTime(i).build();
+    commits.get_subscriber().on_next(
+        std::make_shared<shared_model::proto::Block>(
+            TestBlockBuilder()
+                .height(i + 2)
+                .transactions(
+                    std::vector<shared_model::proto::Transaction>({tx}))
+                .build()));
+  }
+}
+
+/**
+ * @given block storage with more blocks than the seed window
+ * @when duplicate filter is created
+ * @then it is seeded from the last blocks of the window only
+ */
+TEST_F(DuplicateFilterTest, SeededFromLastBlocks) {
+  EXPECT_CALL(*block_query, getTopBlockHeight()).WillOnce(Return(250));
+  EXPECT_CALL(*block_query, getTxHashesFrom(151))
+      .WillOnce(Return(std::vector<shared_model::crypto::Hash>{}));
+
+  DuplicateFilter filter(block_query,
+                         commits.get_observable(),
+                         1min,
+                         DuplicateFilter::kMinCapacity,
+                         DuplicateFilter::kMaxCapacity,
+                         100);
+}
+
+/**
+ * @given duplicate filter being seeded from block storage
+ * @when a block is committed while the storage is read
+ * @then transactions of the block are reported as committed afterwards
+ */
+TEST_F(DuplicateFilterTest, CommitDuringSeedingIsKept) {
+  auto tx = TestTransactionBuilder().creatorAccountId("admin@test").build();
+  auto block = std::make_shared<shared_model::proto::Block>(
+      TestBlockBuilder()
+          .height(2)
+          .transactions(std::vector<shared_model::proto::Transaction>({tx}))
+          .build());
+  EXPECT_CALL(*block_query, getTxHashesFrom(1))
+      .WillOnce(testing::Invoke([&](auto) {
+        commits.get_subscriber().on_next(block);
+        return std::vector<shared_model::crypto::Hash>{};
+      }));
+  DuplicateFilter filter(block_query, commits.get_observable(), 1min);
+  EXPECT_CALL(*block_query, hasTxWithHash(tx.hash())).WillOnce(Return(true));
+
+  ASSERT_FALSE(filter.insert(tx.hash()));
+}
@@ -34,6 +34,35 @@ class MockOrderingServicePersistentState
    */
   MOCK_CONST_METHOD0(loadProposalHeight, boost::optional<size_t>());
 
+  /**
+   * Save height of proposal passed by ordering gate
+   */
+  MOCK_METHOD1(savePassedProposalHeight, bool(size_t height));
+
+  /**
+   * Load height of proposal passed by ordering gate
+   */
+  MOCK_CONST_METHOD0(loadPassedProposalHeight, boost::optional<size_t>());
+
+  /**
+   * Save transaction
+   */
+  MOCK_METHOD1(saveTransaction,
+               bool(const shared_model::interface::Transaction &));
+
+  /**
+   * Remove transactions
+   */
+  MOCK_METHOD1(removeTransactions,
+               bool(const std::vector<shared_model::crypto::Hash> &));
+
+  /**
+   * Load transactions
+   */
+  MOCK_CONST_METHOD0(
+      loadTransactions,
+      std::vector<std::shared_ptr<shared_model::interface::Transaction>>());
+
   /**
    * Reset state
    */
@@ -22,6 +22,7 @@
 #include "builders/protobuf/proposal.hpp"
 #include "builders/protobuf/transaction.hpp"
 #include "module/irohad/network/network_mocks.hpp"
+#include "module/irohad/ordering/mock_ordering_service_persistent_state.hpp"
 #include "module/shared_model/builders/protobuf/test_block_builder.hpp"
 #include "module/shared_model/builders/protobuf/test_proposal_builder.hpp"
 #include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
@@ -160,6 +161,34 @@ TEST_F(OrderingGateTest, ProposalReceivedByGateWhenSent) {
   ASSERT_TRUE(wrapper.validate());
 }
 
+/**
+ * @given Initialized OrderingGate
+ * @when  Ordering service responds to propagated transaction with
+ *        RESOURCE_EXHAUSTED status
+ * @then  Hash of the transaction is emitted as rejected
+ */
+TEST_F(OrderingGateTest, TransactionRejectedWhenServiceOverloaded) {
+  EXPECT_CALL(*fake_service, onTransaction(_, _, _))
+      .WillOnce(Return(grpc::Status(grpc::StatusCode::RESOURCE_EXHAUSTED,
+                                    "Ordering service is overloaded")));
+
+  auto tx = std::make_shared<shared_model::proto::Transaction>(
+      TestTransactionBuilder().build());
+
+  boost::optional<shared_model::interface::types::HashType> rejected;
+  gate_impl->on_rejected_transaction().subscribe([&](const auto &hash) {
+    std::lock_guard<std::mutex> lock(m);
+    rejected = hash;
+    cv.notify_one();
+  });
+
+  gate_impl->propagateTransaction(tx);
+
+  std::unique_lock<std::mutex> lock(m);
+  ASSERT_TRUE(cv.wait_for(lock, 10s, [&] { return bool(rejected); }));
+  ASSERT_EQ(*rejected, tx->hash());
+}
+
 class QueueBehaviorTest : public ::testing::Test {
  public:
   QueueBehaviorTest() : ordering_gate(transport, 1, false){};
@@ -356,3 +385,126 @@ TEST_F(QueueBehaviorTest, CommitNewerThanAllProposals) {
   EXPECT_EQ(1, messages.size());
   EXPECT_EQ(2, messages.at(0)->height());
 }
+
+/**
+ * @given OrderingGate in pipelined mode
+ * AND MockPeerCommunicationService
+ * @when proposal 2 is passed to the pipeline and proposal 3 is received
+ * before commit of block 2
+ * @then proposal 3 is passed to speculative validation once
+ * AND it is passed to the pipeline after commit of block 2
+ * AND proposal 4 is passed to speculative validation then
+ */
+TEST(PipelinedOrderingGateTest, NextProposalIsSpeculative) {
+  auto transport = std::make_shared<MockOrderingGateTransport>();
+  auto pcs = std::make_shared<MockPeerCommunicationService>();
+  rxcpp::subjects::subject<Commit> commit_subject;
+  EXPECT_CALL(*pcs, on_commit())
+      .WillOnce(Return(commit_subject.get_observable()));
+
+  OrderingGateImpl ordering_gate(transport, 1, false, true);
+  ordering_gate.setPcs(*pcs);
+
+  std::vector<std::shared_ptr<shared_model::interface::Proposal>> proposals,
+      speculative;
+  ordering_gate.on_proposal().subscribe(
+      [&](auto proposal) { proposals.push_back(proposal); });
+  ordering_gate.on_speculative_proposal().subscribe(
+      [&](auto proposal) { speculative.push_back(proposal); });
+
+  auto push_proposal = [&](HeightType height) {
+    ordering_gate.onProposal(std::make_shared<shared_model::proto::Proposal>(
+        TestProposalBuilder().height(height).build()));
+  };
+
+  push_proposal(2);
+  push_proposal(3);
+  push_proposal(4);
+
+  ASSERT_EQ(1, proposals.size());
+  ASSERT_EQ(1, speculative.size());
+  EXPECT_EQ(3, speculative.at(0)->height());
+
+  commit_subject.get_subscriber().on_next(rxcpp::observable<>::just(
+      std::static_pointer_cast<shared_model::interface::Block>(
+          std::make_shared<shared_model::proto::Block>(
+              TestBlockBuilder().height(2).build()))));
+
+  ASSERT_EQ(2, proposals.size());
+  EXPECT_EQ(3, proposals.at(1)->height());
+  ASSERT_EQ(2, speculative.size());
+  EXPECT_EQ(4, speculative.at(1)->height());
+}
+
+/**
+ * @given ordering gate which skips empty rounds, with block 1 stored
+ * @when proposals 2, 3 and 4 are received
+ * AND round of proposal 2 is skipped
+ * AND block 2 built from proposal 3 is committed
+ * @then proposal 3 is passed to the pipeline after the skip without commit
+ * AND proposal 4 is passed after commit of block 2
+ */
+TEST(SkippingOrderingGateTest, SkippedRoundPassesNextProposal) {
+  auto transport = std::make_shared<MockOrderingGateTransport>();
+  auto pcs = std::make_shared<MockPeerCommunicationService>();
+  rxcpp::subjects::subject<Commit> commit_subject;
+  EXPECT_CALL(*pcs, on_commit())
+      .WillOnce(Return(commit_subject.get_observable()));
+
+  OrderingGateImpl ordering_gate(transport, 1, false, false, true);
+  ordering_gate.setPcs(*pcs);
+
+  std::vector<HeightType> proposals;
+  ordering_gate.on_proposal().subscribe(
+      [&](auto proposal) { proposals.push_back(proposal->height()); });
+
+  for (HeightType height : {2, 3, 4}) {
+    ordering_gate.onProposal(std::make_shared<shared_model::proto::Proposal>(
+        TestProposalBuilder().height(height).build()));
+  }
+  ASSERT_EQ(std::vector<HeightType>({2}), proposals);
+
+  ordering_gate.skipRound(2);
+  ASSERT_EQ(std::vector<HeightType>({2, 3}), proposals);
+
+  commit_subject.get_subscriber().on_next(rxcpp::observable<>::just(
+      std::static_pointer_cast<shared_model::interface::Block>(
+          std::make_shared<shared_model::proto::Block>(
+              TestBlockBuilder().height(2).build()))));
+  ASSERT_EQ(std::vector<HeightType>({2, 3, 4}), proposals);
+}
+
+/**
+ * @given ordering gate which skips empty rounds, restarted with block 1
+ * stored and proposal 4 passed before restart
+ * @when proposals 6 and 5 are received
+ * @then proposal 5 is passed to the pipeline, but proposal 6 waits for the
+ * end of its round
+ */
+TEST(SkippingOrderingGateTest, RoundIsRestoredAfterRestart) {
+  auto transport = std::make_shared<MockOrderingGateTransport>();
+  auto pcs = std::make_shared<MockPeerCommunicationService>();
+  auto persistent_state =
+      std::make_shared<MockOrderingServicePersistentState>();
+  rxcpp::subjects::subject<Commit> commit_subject;
+  EXPECT_CALL(*pcs, on_commit())
+      .WillOnce(Return(commit_subject.get_observable()));
+  EXPECT_CALL(*persistent_state, loadPassedProposalHeight())
+      .WillOnce(Return(boost::make_optional<size_t>(4)));
+  EXPECT_CALL(*persistent_state, savePassedProposalHeight(5))
+      .WillOnce(Return(true));
+
+  OrderingGateImpl ordering_gate(
+      transport, 1, false, false, true, persistent_state);
+  ordering_gate.setPcs(*pcs);
+
+  std::vector<HeightType> proposals;
+  ordering_gate.on_proposal().subscribe(
+      [&](auto proposal) { proposals.push_back(proposal->height()); });
+
+  for (HeightType height : {6, 5}) {
+    ordering_gate.onProposal(std::make_shared<shared_model::proto::Proposal>(
+        TestProposalBuilder().height(height).build()));
+  }
+  ASSERT_EQ(std::vector<HeightType>({5}), proposals);
+}
@@ -4,6 +4,7 @@
  */
 
 #include <grpc++/grpc++.h>
+#include <boost/range/size.hpp>
 
 #include "backend/protobuf/common_objects/peer.hpp"
 #include "builders/protobuf/common_objects/proto_peer_builder.hpp"
@@ -65,13 +66,17 @@ class OrderingServiceTest : public ::testing::Test {
     fake_transport = std::make_shared<MockOrderingServiceTransport>();
     fake_persistent_state =
         std::make_shared<MockOrderingServicePersistentState>();
+    ON_CALL(*fake_persistent_state, saveTransaction(_))
+        .WillByDefault(Return(true));
+    ON_CALL(*fake_persistent_state, removeTransactions(_))
+        .WillByDefault(Return(true));
   }
 
-  auto getTx() {
+  auto getTx(const std::string &creator = "admin@ru") {
     return std::make_unique<shared_model::proto::Transaction>(
         shared_model::proto::TransactionBuilder()
             .createdTime(iroha::time::now())
-            .creatorAccountId("admin@ru")
+            .creatorAccountId(creator)
             .addAssetQuantity("admin@tu", "coin#coin", "1.0")
             .quorum(1)
             .build()
@@ -81,13 +86,24 @@ class OrderingServiceTest : public ::testing::Test {
             .finish());
   }
 
-  auto initOs(size_t max_proposal) {
+  auto initOs(size_t max_proposal,
+              size_t max_queue_size = 0,
+              AdmissionPolicy admission_policy = AdmissionPolicy::kRejectNew,
+              size_t creator_quota = 0,
+              std::shared_ptr<DuplicateFilter> duplicate_filter = nullptr,
+              std::shared_ptr<ProposalController> proposal_controller =
+                  nullptr) {
     return std::make_shared<OrderingServiceImpl>(
         wsv,
         max_proposal,
         proposal_timeout.get_observable(),
         fake_transport,
         fake_persistent_state,
+        max_queue_size,
+        admission_policy,
+        creator_quota,
+        duplicate_filter,
+        proposal_controller,
         false);
   }
 
@@ -283,6 +299,11 @@ TEST_F(OrderingServiceTest, GenerateProposalDestructor) {
                                       rxcpp::observe_on_new_thread()),
         fake_transport,
         fake_persistent_state,
+        0,
+        AdmissionPolicy::kRejectNew,
+        0,
+        nullptr,
+        nullptr,
         true);
 
     auto on_tx = [&]() {
@@ -296,3 +317,375 @@ TEST_F(OrderingServiceTest, GenerateProposalDestructor) {
   }
   EXPECT_CALL(*fake_transport, publishProposalProxy(_, _)).Times(0);
 }
+
+/**
+ * @given OrderingService with max_queue_size==3 and reject new policy
+ * @when OrderingService::onTransaction called 5 times
+ * @then first 3 transactions are accepted, the rest are rejected
+ *       and only accepted ones are in the proposal
+ */
+TEST_F(OrderingServiceTest, RejectNewWhenQueueIsFull) {
+  const size_t max_proposal = 100;
+  const size_t max_queue_size = 3;
+
+  EXPECT_CALL(*fake_persistent_state, loadProposalHeight())
+      .Times(1)
+      .WillOnce(Return(boost::optional<size_t>(2)));
+  EXPECT_CALL(*fake_persistent_state, saveProposalHeight(_))
+      .Times(1)
+      .WillOnce(Return(true));
+  EXPECT_CALL(*wsv, getLedgerPeers())
+      .WillRepeatedly(Return(std::vector<decltype(peer)>{peer}));
+  EXPECT_CALL(*fake_transport, publishProposalProxy(_, _))
+      .WillOnce(Invoke([&](auto proposal, auto) {
+        ASSERT_EQ(boost::size(proposal->transactions()), max_queue_size);
+      }));
+
+  auto ordering_service =
+      initOs(max_proposal, max_queue_size, AdmissionPolicy::kRejectNew);
+  fake_transport->subscribe(ordering_service);
+
+  for (size_t i = 0; i < max_queue_size; ++i) {
+    ASSERT_TRUE(ordering_service->onTransaction(getTx()));
+  }
+  ASSERT_FALSE(ordering_service->onTransaction(getTx()));
+  ASSERT_FALSE(ordering_service->onTransaction(getTx()));
+
+  ASSERT_EQ(ordering_service->queueSize(), max_queue_size);
+  ASSERT_EQ(ordering_service->rejectedTransactions(), 2);
+
+  makeProposalTimeout();
+  ASSERT_EQ(ordering_service->queueSize(), 0);
+}
+
+/**
+ * @given OrderingService with max_queue_size==3 and drop oldest policy
+ * @when OrderingService::onTransaction called 5 times
+ * @then all transactions are accepted, 2 oldest are dropped
+ *       and proposal consists of 3 newest transactions
+ */
+TEST_F(OrderingServiceTest, DropOldestWhenQueueIsFull) {
+  const size_t max_proposal = 100;
+  const size_t max_queue_size = 3;
+  const size_t tx_num = 5;
+
+  EXPECT_CALL(*fake_persistent_state, loadProposalHeight())
+      .Times(1)
+      .WillOnce(Return(boost::optional<size_t>(2)));
+  EXPECT_CALL(*fake_persistent_state, saveProposalHeight(_))
+      .Times(1)
+      .WillOnce(Return(true));
+  EXPECT_CALL(*wsv, getLedgerPeers())
+      .WillRepeatedly(Return(std::vector<decltype(peer)>{peer}));
+
+  std::vector<shared_model::interface::types::HashType> hashes;
+  EXPECT_CALL(*fake_transport, publishProposalProxy(_, _))
+      .WillOnce(Invoke([&hashes](auto proposal, auto) {
+        std::vector<shared_model::interface::types::HashType> proposal_hashes;
+        for (const auto &tx : proposal->transactions()) {
+          proposal_hashes.push_back(tx.hash());
+        }
+        ASSERT_EQ(proposal_hashes,
+                  decltype(hashes)(hashes.end() - max_queue_size,
+                                   hashes.end()));
+      }));
+
+  auto ordering_service =
+      initOs(max_proposal, max_queue_size, AdmissionPolicy::kDropOldest);
+  fake_transport->subscribe(ordering_service);
+
+  for (size_t i = 0; i < tx_num; ++i) {
+    auto tx = getTx();
+    hashes.push_back(tx->hash());
+    ASSERT_TRUE(ordering_service->onTransaction(std::move(tx)));
+  }
+
+  ASSERT_EQ(ordering_service->queueSize(), max_queue_size);
+  ASSERT_EQ(ordering_service->droppedTransactions(), tx_num - max_queue_size);
+  ASSERT_EQ(ordering_service->rejectedTransactions(), 0);
+
+  makeProposalTimeout();
+}
+
+/**
+ * @given OrderingService with creator quota policy and quota==2
+ * @when one creator sends 3 transactions and another one sends 1
+ * @then the third transaction of the first creator is rejected,
+ *       and the quota is freed after proposal is generated
+ */
+TEST_F(OrderingServiceTest, CreatorQuotaExceeded) {
+  const size_t max_proposal = 100;
+  const size_t max_queue_size = 10;
+  const size_t creator_quota = 2;
+
+  EXPECT_CALL(*fake_persistent_state, loadProposalHeight())
+      .Times(1)
+      .WillOnce(Return(boost::optional<size_t>(2)));
+  EXPECT_CALL(*fake_persistent_state, saveProposalHeight(_))
+      .Times(1)
+      .WillOnce(Return(true));
+  EXPECT_CALL(*wsv, getLedgerPeers())
+      .WillRepeatedly(Return(std::vector<decltype(peer)>{peer}));
+  EXPECT_CALL(*fake_transport, publishProposalProxy(_, _)).Times(1);
+
+  auto ordering_service = initOs(max_proposal,
+                                 max_queue_size,
+                                 AdmissionPolicy::kCreatorQuota,
+                                 creator_quota);
+  fake_transport->subscribe(ordering_service);
+
+  ASSERT_TRUE(ordering_service->onTransaction(getTx("heavy@ru")));
+  ASSERT_TRUE(ordering_service->onTransaction(getTx("heavy@ru")));
+  ASSERT_FALSE(ordering_service->onTransaction(getTx("heavy@ru")));
+  ASSERT_TRUE(ordering_service->onTransaction(getTx("light@ru")));
+  ASSERT_EQ(ordering_service->rejectedTransactions(), 1);
+
+  makeProposalTimeout();
+  ASSERT_TRUE(ordering_service->onTransaction(getTx("heavy@ru")));
+}
+
+/**
+ * @given OrderingService with max_proposal==3
+ * @when one creator sends 2 transactions
+ *       and after that another creator sends 1 transaction
+ * @then proposal alternates transactions of the creators
+ */
+TEST_F(OrderingServiceTest, ProposalIsFilledFairlyByCreators) {
+  const size_t max_proposal = 3;
+
+  EXPECT_CALL(*fake_persistent_state, loadProposalHeight())
+      .Times(1)
+      .WillOnce(Return(boost::optional<size_t>(2)));
+  EXPECT_CALL(*fake_persistent_state, saveProposalHeight(_))
+      .Times(1)
+      .WillOnce(Return(true));
+  EXPECT_CALL(*wsv, getLedgerPeers())
+      .WillRepeatedly(Return(std::vector<decltype(peer)>{peer}));
+
+  std::vector<std::string> creators;
+  EXPECT_CALL(*fake_transport, publishProposalProxy(_, _))
+      .WillOnce(Invoke([&creators](auto proposal, auto) {
+        for (const auto &tx : proposal->transactions()) {
+          creators.push_back(tx.creatorAccountId());
+        }
+      }));
+
+  auto ordering_service = initOs(max_proposal);
+  fake_transport->subscribe(ordering_service);
+
+  ordering_service->onTransaction(getTx("heavy@ru"));
+  ordering_service->onTransaction(getTx("heavy@ru"));
+  ordering_service->onTransaction(getTx("light@ru"));
+
+  ASSERT_EQ(creators,
+            std::vector<std::string>({"heavy@ru", "light@ru", "heavy@ru"}));
+}
+
+/**
+ * @given OrderingService with duplicate filter and empty ledger
+ * @when the same transaction is received twice
+ * @then proposal contains it once and the duplicate is counted
+ */
+TEST_F(OrderingServiceTest, DuplicateTransactionIsDropped) {
+  const size_t max_proposal = 100;
+
+  EXPECT_CALL(*fake_persistent_state, loadProposalHeight())
+      .Times(1)
+      .WillOnce(Return(boost::optional<size_t>(2)));
+  EXPECT_CALL(*fake_persistent_state, saveProposalHeight(_))
+      .Times(1)
+      .WillOnce(Return(true));
+  EXPECT_CALL(*wsv, getLedgerPeers())
+      .WillRepeatedly(Return(std::vector<decltype(peer)>{peer}));
+
+  size_t proposal_size = 0;
+  EXPECT_CALL(*fake_transport, publishProposalProxy(_, _))
+      .WillOnce(Invoke([&proposal_size](auto proposal, auto) {
+        proposal_size = boost::size(proposal->transactions());
+      }));
+
+  auto block_query = std::make_shared<MockBlockQuery>();
+  EXPECT_CALL(*block_query, getTxHashesFrom(1))
+      .WillOnce(Return(std::vector<shared_model::crypto::Hash>{}));
+  rxcpp::subjects::subject<std::shared_ptr<shared_model::interface::Block>>
+      commits;
+  auto duplicate_filter = std::make_shared<DuplicateFilter>(
+      block_query, commits.get_observable(), 1min);
+
+  auto ordering_service = initOs(
+      max_proposal, 0, AdmissionPolicy::kRejectNew, 0, duplicate_filter);
+  fake_transport->subscribe(ordering_service);
+
+  std::shared_ptr<shared_model::interface::Transaction> tx = getTx();
+  ASSERT_TRUE(ordering_service->onTransaction(tx));
+  ASSERT_TRUE(ordering_service->onTransaction(tx));
+  ASSERT_EQ(ordering_service->queueSize(), 1);
+  ASSERT_EQ(ordering_service->duplicateTransactions(), 1);
+
+  makeProposalTimeout();
+  ASSERT_EQ(proposal_size, 1);
+}
+
+/**
+ * @given OrderingService with duplicate filter and empty ledger
+ * @when multisignature transaction is received twice with the same hash and
+ * different signatures
+ * @then both submissions are queued and none is counted as duplicate
+ */
+TEST_F(OrderingServiceTest, ResignedTransactionIsNotDropped) {
+  const size_t max_proposal = 100;
+
+  EXPECT_CALL(*fake_persistent_state, loadProposalHeight())
+      .Times(1)
+      .WillOnce(Return(boost::optional<size_t>(2)));
+
+  auto block_query = std::make_shared<MockBlockQuery>();
+  EXPECT_CALL(*block_query, getTxHashesFrom(1))
+      .WillOnce(Return(std::vector<shared_model::crypto::Hash>{}));
+  rxcpp::subjects::subject<std::shared_ptr<shared_model::interface::Block>>
+      commits;
+  auto duplicate_filter = std::make_shared<DuplicateFilter>(
+      block_query, commits.get_observable(), 1min);
+
+  auto ordering_service = initOs(
+      max_proposal, 0, AdmissionPolicy::kRejectNew, 0, duplicate_filter);
+
+  auto created_time = iroha::time::now();
+  auto signed_tx = [created_time] {
+    return std::make_shared<shared_model::proto::Transaction>(
+        shared_model::proto::TransactionBuilder()
+            .createdTime(created_time)
+            .creatorAccountId("admin@ru")
+            .addAssetQuantity("admin@tu", "coin#coin", "1.0")
+            .quorum(2)
+            .build()
+            .signAndAddSignature(
+                shared_model::crypto::DefaultCryptoAlgorithmType::
+                    generateKeypair())
+            .finish());
+  };
+  auto first = signed_tx();
+  auto second = signed_tx();
+  ASSERT_EQ(first->hash(), second->hash());
+
+  ASSERT_TRUE(ordering_service->onTransaction(first));
+  ASSERT_TRUE(ordering_service->onTransaction(second));
+  ASSERT_EQ(ordering_service->queueSize(), 2);
+  ASSERT_EQ(ordering_service->duplicateTransactions(), 0);
+  ASSERT_EQ(duplicate_filter->pendingSize(), 0);
+}
+
+/**
+ * @given OrderingService in adaptive mode with proposal size bounded by 2
+ * and long proposal delay
+ * @when 3 transactions are received and timer ticks
+ * @then proposal of 2 transactions is generated without waiting for the
+ * delay, and the third transaction stays in the queue
+ */
+TEST_F(OrderingServiceTest, AdaptiveModeUsesControllerBounds) {
+  const size_t max_proposal = 100;
+
+  EXPECT_CALL(*fake_persistent_state, loadProposalHeight())
+      .Times(1)
+      .WillOnce(Return(boost::optional<size_t>(2)));
+  EXPECT_CALL(*fake_persistent_state, saveProposalHeight(_))
+      .Times(1)
+      .WillOnce(Return(true));
+  EXPECT_CALL(*wsv, getLedgerPeers())
+      .WillRepeatedly(Return(std::vector<decltype(peer)>{peer}));
+
+  size_t proposal_size = 0;
+  EXPECT_CALL(*fake_transport, publishProposalProxy(_, _))
+      .WillOnce(Invoke([&proposal_size](auto proposal, auto) {
+        proposal_size = boost::size(proposal->transactions());
+      }));
+
+  rxcpp::subjects::subject<std::shared_ptr<shared_model::interface::Block>>
+      commits;
+  auto controller = std::make_shared<ProposalController>(
+      ProposalBounds{1, 2, 1h, 1h}, commits.get_observable());
+
+  auto ordering_service = initOs(max_proposal,
+                                 0,
+                                 AdmissionPolicy::kRejectNew,
+                                 0,
+                                 nullptr,
+                                 controller);
+  fake_transport->subscribe(ordering_service);
+
+  for (auto i = 0; i < 3; ++i) {
+    ordering_service->onTransaction(getTx());
+  }
+  makeProposalTimeout();
+
+  ASSERT_EQ(proposal_size, 2);
+  ASSERT_EQ(ordering_service->queueSize(), 1);
+}
+
+/**
+ * @given persistent state with 2 saved transactions
+ * @when OrderingService is created and timer ticks
+ * @then saved transactions are proposed and removed from persistent state
+ */
+TEST_F(OrderingServiceTest, SavedTransactionsAreRestored) {
+  std::vector<std::shared_ptr<shared_model::interface::Transaction>> saved{
+      getTx(), getTx()};
+  std::vector<shared_model::crypto::Hash> hashes{saved[0]->hash(),
+                                                 saved[1]->hash()};
+
+  EXPECT_CALL(*fake_persistent_state, loadProposalHeight())
+      .Times(1)
+      .WillOnce(Return(boost::optional<size_t>(2)));
+  EXPECT_CALL(*fake_persistent_state, loadTransactions())
+      .WillOnce(Return(saved));
+  EXPECT_CALL(*fake_persistent_state, removeTransactions(hashes))
+      .WillOnce(Return(true));
+  EXPECT_CALL(*fake_persistent_state, saveProposalHeight(3))
+      .WillOnce(Return(true));
+  EXPECT_CALL(*wsv, getLedgerPeers())
+      .WillRepeatedly(Return(std::vector<decltype(peer)>{peer}));
+  EXPECT_CALL(*fake_transport, publishProposalProxy(_, _)).Times(1);
+
+  auto ordering_service = initOs(100);
+  fake_transport->subscribe(ordering_service);
+  ASSERT_EQ(ordering_service->queueSize(), 2);
+
+  makeProposalTimeout();
+  ASSERT_EQ(ordering_service->queueSize(), 0);
+}
+
+/**
+ * @given OrderingServiceTransportGrpc subscribed by ordering service with
+ *        full queue
+ * @when transaction is received by the transport
+ * @then transport responds with RESOURCE_EXHAUSTED status
+ */
+TEST_F(OrderingServiceTest, TransportRespondsResourceExhaustedWhenRejected) {
+  EXPECT_CALL(*fake_persistent_state, loadProposalHeight())
+      .Times(1)
+      .WillOnce(Return(boost::optional<size_t>(2)));
+
+  auto transport = std::make_shared<OrderingServiceTransportGrpc>();
+  auto ordering_service = std::make_shared<OrderingServiceImpl>(
+      wsv,
+      100,
+      proposal_timeout.get_observable(),
+      transport,
+      fake_persistent_state,
+      1,
+      AdmissionPolicy::kRejectNew,
+      0,
+      nullptr,
+      nullptr,
+      false);
+  transport->subscribe(ordering_service);
+
+  google::protobuf::Empty response;
+  auto tx = getTx();
+  ASSERT_TRUE(
+      transport->onTransaction(nullptr, &tx->getTransport(), &response).ok());
+  ASSERT_EQ(
+      transport->onTransaction(nullptr, &tx->getTransport(), &response)
+          .error_code(),
+      grpc::StatusCode::RESOURCE_EXHAUSTED);
+}
@@ -0,0 +1,131 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <gtest/gtest.h>
+
+#include "ordering/impl/proposal_controller.hpp"
+
+using namespace iroha::ordering;
+using namespace std::chrono_literals;
+
+class ProposalControllerTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    controller = std::make_shared<ProposalController>(
+        ProposalBounds{10, 170, 10ms, 1000ms}, commits.get_observable());
+  }
+
+  /**
+   * Publish proposal of given creation time and commit it after latency
+   */
+  void commitAfter(shared_model::interface::types::TimestampType created_time,
+                   std::chrono::milliseconds latency) {
+    controller->onProposal(created_time, now);
+    now += latency;
+    controller->onCommit(created_time, now);
+  }
+
+  ProposalController::Clock::time_point now =
+      ProposalController::Clock::now();
+  rxcpp::subjects::subject<std::shared_ptr<shared_model::interface::Block>>
+      commits;
+  std::shared_ptr<ProposalController> controller;
+};
+
+/**
+ * @given controller without measurements
+ * @when size and delay are requested
+ * @then maximal size and minimal delay are returned
+ */
+TEST_F(ProposalControllerTest, InitialState) {
+  ASSERT_EQ(controller->proposalSize(), 170);
+  ASSERT_EQ(controller->proposalDelay(), 10ms);
+}
+
+/**
+ * @given controller
+ * @when proposals are committed slower than the maximal delay
+ * @then proposal size is halved down to the minimum
+ * and the delay grows up to the maximum
+ */
+TEST_F(ProposalControllerTest, SlowCommitsShrinkProposals) {
+  commitAfter(1, 10000ms);
+  ASSERT_EQ(controller->proposalSize(), 85);
+  ASSERT_EQ(controller->proposalDelay(), 1000ms);
+
+  for (auto height = 2; height < 10; ++height) {
+    commitAfter(height, 10000ms);
+  }
+  ASSERT_EQ(controller->proposalSize(), 10);
+}
+
+/**
+ * @given controller with shrunk proposal size
+ * @when proposals are committed fast
+ * @then proposal size grows additively up to the maximum
+ * and the delay follows the commit latency
+ */
+TEST_F(ProposalControllerTest, FastCommitsGrowProposals) {
+  commitAfter(1, 10000ms);
+  commitAfter(2, 10000ms);
+  ASSERT_EQ(controller->proposalSize(), 42);
+
+  size_t height = 3;
+  // wait until the average latency fits the maximal delay
+  for (; height < 13; ++height) {
+    commitAfter(height, 100ms);
+  }
+  auto size = controller->proposalSize();
+  ASSERT_LT(size, 170);
+  commitAfter(height++, 100ms);
+  ASSERT_EQ(controller->proposalSize(), size + 10);
+
+  for (auto i = 0; i < 50; ++i) {
+    commitAfter(height++, 100ms);
+  }
+  ASSERT_EQ(controller->proposalSize(), 170);
+  ASSERT_LE(controller->proposalDelay(), 101ms);
+  ASSERT_GE(controller->proposalDelay(), 99ms);
+}
+
+/**
+ * @given controller
+ * @when block which was not proposed is committed
+ * @then size and delay are not changed
+ */
+TEST_F(ProposalControllerTest, UnknownCommitIsIgnored) {
+  controller->onCommit(5, now + 10000ms);
+  ASSERT_EQ(controller->proposalSize(), 170);
+  ASSERT_EQ(controller->proposalDelay(), 10ms);
+}
+
+/**
+ * @given controller
+ * @when round of a proposal is skipped and the next proposal is published
+ * much later and committed fast
+ * @then commit latency is measured from the proposal of the block
+ */
+TEST_F(ProposalControllerTest, SkippedProposalIsNotMatched) {
+  commitAfter(1, 100ms);
+  controller->onProposal(2, now);
+  now += 10000ms;
+  commitAfter(3, 100ms);
+
+  ASSERT_EQ(controller->proposalSize(), 170);
+  ASSERT_LT(controller->proposalDelay(), 100ms);
+}
+
+/**
+ * @given controller with minimal delay
+ * @when it is asked whether to propose
+ * @then it proposes only non-empty queue, when it fills the proposal
+ * or when the delay has passed
+ */
+TEST_F(ProposalControllerTest, ShouldPropose) {
+  ASSERT_FALSE(controller->shouldPropose(0, now, now + 1h));
+  ASSERT_FALSE(controller->shouldPropose(1, now, now + 5ms));
+  ASSERT_TRUE(controller->shouldPropose(1, now, now + 10ms));
+  ASSERT_TRUE(controller->shouldPropose(170, now, now));
+}
@@ -37,6 +37,8 @@ using namespace framework::test_subscriber;
 
 using ::testing::_;
 using ::testing::A;
+using ::testing::AnyNumber;
+using ::testing::Invoke;
 using ::testing::Return;
 using ::testing::ReturnArg;
 
@@ -52,6 +54,8 @@ class SimulatorTest : public ::testing::Test {
     factory = std::make_shared<MockTemporaryFactory>();
     query = std::make_shared<MockBlockQuery>();
     ordering_gate = std::make_shared<MockOrderingGate>();
+    ON_CALL(*ordering_gate, on_speculative_proposal())
+        .WillByDefault(Return(speculative_proposals.get_observable()));
     crypto_signer = std::make_shared<shared_model::crypto::CryptoModelSigner<>>(
         shared_model::crypto::DefaultCryptoAlgorithmType::generateKeypair());
   }
@@ -61,8 +65,13 @@ class SimulatorTest : public ::testing::Test {
   }
 
   void init() {
-    simulator = std::make_shared<Simulator>(
-        ordering_gate, validator, factory, query, crypto_signer);
+    simulator = std::make_shared<Simulator>(ordering_gate,
+                                            validator,
+                                            factory,
+                                            query,
+                                            crypto_signer,
+                                            skip_empty_blocks,
+                                            speculation_worker);
   }
 
   std::shared_ptr<MockStatefulValidator> validator;
@@ -72,6 +81,12 @@ class SimulatorTest : public ::testing::Test {
   std::shared_ptr<shared_model::crypto::CryptoModelSigner<>> crypto_signer;
 
   std::shared_ptr<Simulator> simulator;
+  bool skip_empty_blocks = false;
+  // speculative proposals are validated synchronously in tests
+  rxcpp::observe_on_one_worker speculation_worker{
+      rxcpp::schedulers::make_current_thread()};
+  rxcpp::subjects::subject<std::shared_ptr<shared_model::interface::Proposal>>
+      speculative_proposals;
 };
 
 shared_model::proto::Block makeBlock(int height) {
@@ -246,3 +261,194 @@ TEST_F(SimulatorTest, FailWhenSameAsProposalHeight) {
   ASSERT_TRUE(proposal_wrapper.validate());
   ASSERT_TRUE(block_wrapper.validate());
 }
+
+/**
+ * @given simulator which skips empty blocks
+ * AND proposal of height 3 on top of block 1, because round 2 was skipped
+ * @when none of proposal transactions passes stateful validation
+ * @then the round is skipped in ordering gate
+ * AND no block is produced
+ */
+TEST_F(SimulatorTest, EmptyProposalIsSkipped) {
+  skip_empty_blocks = true;
+  auto proposal = makeProposal(3);
+  auto empty_proposal = std::make_shared<shared_model::proto::Proposal>(
+      shared_model::proto::ProposalBuilder()
+          .height(proposal.height())
+          .createdTime(proposal.createdTime())
+          .transactions(std::vector<shared_model::proto::Transaction>{})
+          .build());
+
+  EXPECT_CALL(*factory, createTemporaryWsv()).Times(1);
+  EXPECT_CALL(*query, getTopBlock())
+      .WillOnce(Return(expected::makeValue(wBlock(clone(makeBlock(1))))));
+  EXPECT_CALL(*validator, validate(_, _)).WillOnce(Return(empty_proposal));
+  EXPECT_CALL(*ordering_gate, on_proposal())
+      .WillOnce(Return(rxcpp::observable<>::empty<
+                       std::shared_ptr<shared_model::interface::Proposal>>()));
+  EXPECT_CALL(*ordering_gate, skipRound(proposal.height()));
+  EXPECT_CALL(*shared_model::crypto::crypto_signer_expecter,
+              sign(A<shared_model::interface::Block &>()))
+      .Times(0);
+
+  init();
+
+  auto block_wrapper =
+      make_test_subscriber<CallExact>(simulator->on_block(), 0);
+  block_wrapper.subscribe();
+
+  simulator->process_proposal(proposal);
+
+  ASSERT_TRUE(block_wrapper.validate());
+}
+
+/**
+ * @given simulator which skips empty blocks, with block 1 stored
+ * AND empty proposal of height 3 processed after launch
+ * @when proposals of heights 5 and 4 are processed
+ * @then proposal 5 is ignored, because it is ahead of the next round
+ * AND proposal 4 is validated and its round is skipped
+ */
+TEST_F(SimulatorTest, ProposalAheadOfRoundIsIgnored) {
+  skip_empty_blocks = true;
+  auto make_empty = [](auto height) {
+    return std::make_shared<shared_model::proto::Proposal>(
+        shared_model::proto::ProposalBuilder()
+            .height(height)
+            .createdTime(iroha::time::now())
+            .transactions(std::vector<shared_model::proto::Transaction>{})
+            .build());
+  };
+
+  EXPECT_CALL(*factory, createTemporaryWsv()).Times(2);
+  EXPECT_CALL(*query, getTopBlock())
+      .WillRepeatedly(Invoke(
+          [] { return expected::makeValue(wBlock(clone(makeBlock(1)))); }));
+  EXPECT_CALL(*validator, validate(_, _))
+      .WillOnce(Return(make_empty(3)))
+      .WillOnce(Return(make_empty(4)));
+  EXPECT_CALL(*ordering_gate, on_proposal())
+      .WillOnce(Return(rxcpp::observable<>::empty<
+                       std::shared_ptr<shared_model::interface::Proposal>>()));
+  EXPECT_CALL(*ordering_gate, skipRound(3));
+  EXPECT_CALL(*ordering_gate, skipRound(4));
+
+  init();
+
+  simulator->process_proposal(makeProposal(3));
+  simulator->process_proposal(makeProposal(5));
+  simulator->process_proposal(makeProposal(4));
+}
+
+class SpeculativeSimulatorTest : public SimulatorTest {
+ public:
+  void SetUp() override {
+    SimulatorTest::SetUp();
+    EXPECT_CALL(*ordering_gate, on_proposal())
+        .WillOnce(Return(
+            rxcpp::observable<>::empty<
+                std::shared_ptr<shared_model::interface::Proposal>>()));
+    EXPECT_CALL(*ordering_gate, on_speculative_proposal());
+    auto make_wsv = [] {
+      auto wsv = std::make_unique<MockTemporaryWsv>();
+      EXPECT_CALL(*wsv, apply(_, _)).WillRepeatedly(Return(true));
+      return expected::makeValue<std::unique_ptr<TemporaryWsv>>(
+          std::move(wsv));
+    };
+    EXPECT_CALL(*factory, createTemporaryWsv())
+        .Times(AnyNumber())
+        .WillRepeatedly(Invoke(make_wsv));
+    // state after the candidate block is provided by the storage
+    EXPECT_CALL(*factory, createTemporaryWsv(_))
+        .Times(AnyNumber())
+        .WillRepeatedly(
+            Invoke([make_wsv](const auto &) { return make_wsv(); }));
+    EXPECT_CALL(*shared_model::crypto::crypto_signer_expecter,
+                sign(A<shared_model::interface::Block &>()))
+        .Times(AnyNumber());
+    init();
+  }
+
+  /**
+   * Validate proposal of height 2 on top of block 1, so the simulator
+   * produces and remembers candidate block 2, then pass proposal of height 3
+   * for speculative validation
+   * @return candidate block 2
+   */
+  wBlock speculate() {
+    auto top_block = makeBlock(1);
+    EXPECT_CALL(*query, getTopBlock())
+        .WillOnce(Return(expected::makeValue(wBlock(clone(top_block)))));
+    EXPECT_CALL(*query, getTopBlockHeight()).WillOnce(Return(1));
+
+    wBlock candidate;
+    simulator->on_block().take(1).subscribe(
+        [&candidate](const auto &block_variant) {
+          candidate = boost::apply_visitor(
+              framework::SpecifiedVisitor<wBlock>(), block_variant);
+        });
+    simulator->process_proposal(*proposal2);
+    speculative_proposals.get_subscriber().on_next(proposal3);
+    return candidate;
+  }
+
+  std::shared_ptr<shared_model::interface::Proposal> proposal2 =
+      std::make_shared<shared_model::proto::Proposal>(makeProposal(2));
+  std::shared_ptr<shared_model::interface::Proposal> proposal3 =
+      std::make_shared<shared_model::proto::Proposal>(makeProposal(3));
+};
+
+/**
+ * @given simulator which validated proposal 3 on top of candidate block 2
+ * @when candidate block 2 is committed and proposal 3 is processed
+ * @then result of speculative validation is used without validating again
+ */
+TEST_F(SpeculativeSimulatorTest, SpeculativeResultIsReused) {
+  EXPECT_CALL(*validator, validate(_, _))
+      .WillOnce(Return(proposal2))
+      .WillOnce(Return(proposal3));
+
+  auto candidate = speculate();
+  ASSERT_TRUE(candidate);
+
+  EXPECT_CALL(*query, getTopBlock())
+      .WillOnce(Return(expected::makeValue(candidate)));
+  EXPECT_CALL(*query, getTopBlockHeight()).WillOnce(Return(2));
+
+  auto proposal_wrapper =
+      make_test_subscriber<CallExact>(simulator->on_verified_proposal(), 1);
+  proposal_wrapper.subscribe([this](auto verified_proposal) {
+    ASSERT_EQ(proposal3, verified_proposal);
+  });
+
+  simulator->process_proposal(*proposal3);
+
+  ASSERT_TRUE(proposal_wrapper.validate());
+}
+
+/**
+ * @given simulator which validated proposal 3 on top of candidate block 2
+ * @when another block 2 is committed and proposal 3 is processed
+ * @then speculative result is discarded and proposal 3 is validated again
+ */
+TEST_F(SpeculativeSimulatorTest, SpeculativeResultIsDiscarded) {
+  EXPECT_CALL(*validator, validate(_, _))
+      .WillOnce(Return(proposal2))
+      .WillOnce(Return(proposal3))
+      .WillOnce(Return(proposal3));
+
+  ASSERT_TRUE(speculate());
+
+  auto committed = makeBlock(2);
+  EXPECT_CALL(*query, getTopBlock())
+      .WillOnce(Return(expected::makeValue(wBlock(clone(committed)))));
+  EXPECT_CALL(*query, getTopBlockHeight()).WillOnce(Return(2));
+
+  auto proposal_wrapper =
+      make_test_subscriber<CallExact>(simulator->on_verified_proposal(), 1);
+  proposal_wrapper.subscribe();
+
+  simulator->process_proposal(*proposal3);
+
+  ASSERT_TRUE(proposal_wrapper.validate());
+}
@@ -67,8 +67,11 @@ class SynchronizerTest : public ::testing::Test {
   }
 
   void init() {
-    synchronizer = std::make_shared<SynchronizerImpl>(
-        consensus_gate, chain_validator, mutable_factory, block_loader);
+    synchronizer = std::make_shared<SynchronizerImpl>(consensus_gate,
+                                                      chain_validator,
+                                                      mutable_factory,
+                                                      block_loader,
+                                                      chunk_size);
   }
 
   std::shared_ptr<shared_model::interface::Block> makeCommit(
@@ -94,6 +97,7 @@ class SynchronizerTest : public ::testing::Test {
   std::shared_ptr<MockConsensusGate> consensus_gate;
 
   std::shared_ptr<SynchronizerImpl> synchronizer;
+  size_t chunk_size = SynchronizerImpl::kDefaultChunkSize;
 };
 
 TEST_F(SynchronizerTest, ValidWhenInitialized) {
@@ -124,7 +128,7 @@ TEST_F(SynchronizerTest, ValidWhenSingleCommitSynchronized) {
   EXPECT_CALL(*chain_validator, validateBlock(testing::Ref(*test_block), _))
       .WillOnce(Return(true));
 
-  EXPECT_CALL(*block_loader, retrieveBlocks(_)).Times(0);
+  EXPECT_CALL(*block_loader, retrieveChain(_, _)).Times(0);
 
   EXPECT_CALL(*consensus_gate, on_commit())
       .WillOnce(Return(
@@ -165,7 +169,7 @@ TEST_F(SynchronizerTest, ValidWhenBadStorage) {
 
   EXPECT_CALL(*chain_validator, validateBlock(_, _)).Times(0);
 
-  EXPECT_CALL(*block_loader, retrieveBlocks(_)).Times(0);
+  EXPECT_CALL(*block_loader, retrieveChain(_, _)).Times(0);
 
   EXPECT_CALL(*consensus_gate, on_commit())
       .WillOnce(Return(
@@ -201,7 +205,7 @@ TEST_F(SynchronizerTest, ValidWhenValidChain) {
 
   EXPECT_CALL(*chain_validator, validateChain(_, _)).WillOnce(Return(true));
 
-  EXPECT_CALL(*block_loader, retrieveBlocks(_))
+  EXPECT_CALL(*block_loader, retrieveChain(_, _))
       .WillOnce(Return(rxcpp::observable<>::just(commit_message)));
 
   EXPECT_CALL(*consensus_gate, on_commit())
@@ -246,7 +250,7 @@ TEST_F(SynchronizerTest, InvalidWhenUnexpectedEnd) {
   EXPECT_CALL(*chain_validator, validateChain(_, _)).WillOnce(Return(true));
 
   // wrong block has different hash
-  EXPECT_CALL(*block_loader, retrieveBlocks(_))
+  EXPECT_CALL(*block_loader, retrieveChain(_, _))
       .WillOnce(Return(rxcpp::observable<>::just(makeCommit(2))));
 
   EXPECT_CALL(*consensus_gate, on_commit())
@@ -267,7 +271,7 @@ TEST_F(SynchronizerTest, InvalidWhenUnexpectedEnd) {
 /**
  * @given A valid block that cannot be applied directly
  * @when process_commit is called
- * @then observable of retrieveBlocks must be evaluated once
+ * @then observable of retrieveChain must be evaluated once
  */
 TEST_F(SynchronizerTest, OnlyOneRetrieval) {
   auto commit_message = makeCommit();
@@ -285,14 +289,14 @@ TEST_F(SynchronizerTest, OnlyOneRetrieval) {
         chain.as_blocking().subscribe([](auto) {});
         return true;
       }));
-  EXPECT_CALL(*block_loader, retrieveBlocks(_))
+  EXPECT_CALL(*block_loader, retrieveChain(_, _))
       .WillOnce(Return(rxcpp::observable<>::create<
                        std::shared_ptr<shared_model::interface::Block>>(
           [commit_message](auto s) {
             static int times = 0;
             if (times++) {
               FAIL()
-                  << "Observable of retrieveBlocks must be evaluated only once";
+                  << "Observable of retrieveChain must be evaluated only once";
             }
             s.on_next(commit_message);
             s.on_completed();
@@ -304,3 +308,131 @@ TEST_F(SynchronizerTest, OnlyOneRetrieval) {
   synchronizer->process_commit(commit_message);
   ASSERT_TRUE(wrapper.validate());
 }
+
+/**
+ * @given A commit from consensus and initialized components with chunk size 2
+ * @when A valid chain of 3 blocks with expected ending is downloaded
+ * @then the chain is validated and committed in 2 chunks
+ * AND every chunk is passed to subscribers
+ */
+TEST_F(SynchronizerTest, ChainIsCommittedInChunks) {
+  chunk_size = 2;
+  auto commit_message = makeCommit();
+  std::vector<std::shared_ptr<shared_model::interface::Block>> chain{
+      makeCommit(1), makeCommit(2), commit_message};
+
+  DefaultValue<expected::Result<std::unique_ptr<MutableStorage>, std::string>>::
+      SetFactory(&createMockMutableStorage);
+  EXPECT_CALL(*mutable_factory, createMutableStorage()).Times(3);
+
+  EXPECT_CALL(*mutable_factory, commit_(_)).Times(2);
+
+  EXPECT_CALL(*chain_validator, validateBlock(testing::Ref(*commit_message), _))
+      .WillOnce(Return(false));
+
+  EXPECT_CALL(*chain_validator, validateChain(_, _))
+      .Times(2)
+      .WillRepeatedly(Return(true));
+
+  EXPECT_CALL(*block_loader, retrieveChain(_, _))
+      .WillOnce(Return(rxcpp::observable<>::iterate(chain)));
+
+  EXPECT_CALL(*consensus_gate, on_commit())
+      .WillOnce(Return(
+          rxcpp::observable<>::empty<shared_model::interface::BlockVariant>()));
+
+  init();
+
+  std::vector<size_t> chunk_sizes;
+  auto wrapper =
+      make_test_subscriber<CallExact>(synchronizer->on_commit_chain(), 2);
+  wrapper.subscribe([&chunk_sizes](auto commit) {
+    chunk_sizes.push_back(commit.count().as_blocking().first());
+  });
+
+  synchronizer->process_commit(commit_message);
+
+  ASSERT_TRUE(wrapper.validate());
+  ASSERT_EQ((std::vector<size_t>{2, 1}), chunk_sizes);
+}
+
+/**
+ * @given A commit from consensus with a single signature and chunk size 1
+ * @when the first chunk of downloaded chain is valid and the second one is
+ * not
+ * @then only the first chunk is committed and the download is stopped
+ */
+TEST_F(SynchronizerTest, InvalidChunkStopsDownload) {
+  chunk_size = 1;
+  auto commit_message = makeCommit();
+  std::vector<std::shared_ptr<shared_model::interface::Block>> chain{
+      makeCommit(1), makeCommit(2), commit_message};
+
+  DefaultValue<expected::Result<std::unique_ptr<MutableStorage>, std::string>>::
+      SetFactory(&createMockMutableStorage);
+  EXPECT_CALL(*mutable_factory, createMutableStorage()).Times(3);
+
+  EXPECT_CALL(*mutable_factory, commit_(_)).Times(1);
+
+  EXPECT_CALL(*chain_validator, validateBlock(testing::Ref(*commit_message), _))
+      .WillOnce(Return(false));
+
+  EXPECT_CALL(*chain_validator, validateChain(_, _))
+      .WillOnce(Return(true))
+      .WillOnce(Return(false));
+
+  EXPECT_CALL(*block_loader, retrieveChain(_, _))
+      .WillOnce(Return(rxcpp::observable<>::iterate(chain)));
+
+  EXPECT_CALL(*consensus_gate, on_commit())
+      .WillOnce(Return(
+          rxcpp::observable<>::empty<shared_model::interface::BlockVariant>()));
+
+  init();
+
+  auto wrapper =
+      make_test_subscriber<CallExact>(synchronizer->on_commit_chain(), 1);
+  wrapper.subscribe();
+
+  synchronizer->process_commit(commit_message);
+
+  ASSERT_TRUE(wrapper.validate());
+}
+
+/**
+ * @given A commit from consensus and initialized components
+ * @when no blocks are downloaded
+ * @then nothing is validated or committed
+ */
+TEST_F(SynchronizerTest, EmptyChainIsIgnored) {
+  auto commit_message = makeCommit();
+
+  DefaultValue<expected::Result<std::unique_ptr<MutableStorage>, std::string>>::
+      SetFactory(&createMockMutableStorage);
+  EXPECT_CALL(*mutable_factory, createMutableStorage()).Times(1);
+
+  EXPECT_CALL(*mutable_factory, commit_(_)).Times(0);
+
+  EXPECT_CALL(*chain_validator, validateBlock(testing::Ref(*commit_message), _))
+      .WillOnce(Return(false));
+
+  EXPECT_CALL(*chain_validator, validateChain(_, _)).Times(0);
+
+  EXPECT_CALL(*block_loader, retrieveChain(_, _))
+      .WillOnce(Return(rxcpp::observable<>::empty<
+                       std::shared_ptr<shared_model::interface::Block>>()));
+
+  EXPECT_CALL(*consensus_gate, on_commit())
+      .WillOnce(Return(
+          rxcpp::observable<>::empty<shared_model::interface::BlockVariant>()));
+
+  init();
+
+  auto wrapper =
+      make_test_subscriber<CallExact>(synchronizer->on_commit_chain(), 0);
+  wrapper.subscribe();
+
+  synchronizer->process_commit(commit_message);
+
+  ASSERT_TRUE(wrapper.validate());
+}
@@ -35,6 +35,8 @@ class TransactionProcessorTest : public ::testing::Test {
         .WillRepeatedly(Return(prop_notifier.get_observable()));
     EXPECT_CALL(*pcs, on_commit())
         .WillRepeatedly(Return(commit_notifier.get_observable()));
+    EXPECT_CALL(*pcs, on_rejected_transaction())
+        .WillRepeatedly(Return(rejected_notifier.get_observable()));
 
     EXPECT_CALL(*mp, onPreparedTransactionsImpl())
         .WillRepeatedly(Return(mst_prepared_notifier.get_observable()));
@@ -90,6 +92,8 @@ class TransactionProcessorTest : public ::testing::Test {
   rxcpp::subjects::subject<std::shared_ptr<shared_model::interface::Proposal>>
       prop_notifier;
   rxcpp::subjects::subject<Commit> commit_notifier;
+  rxcpp::subjects::subject<shared_model::interface::types::HashType>
+      rejected_notifier;
 
   const size_t proposal_size = 5;
   const size_t block_size = 3;
@@ -385,3 +389,28 @@ TEST_F(TransactionProcessorTest, MultisigExpired) {
 
   ASSERT_TRUE(wrapper.validate());
 }
+
+/**
+ * @given valid transaction
+ * @when transaction_processor handle it
+ * and ordering service rejects it because of overload
+ * @then ensure it leads to OVERLOADED status
+ */
+TEST_F(TransactionProcessorTest, TransactionProcessorOnOverloaded) {
+  EXPECT_CALL(*pcs, propagate_transaction(_)).Times(1);
+
+  std::shared_ptr<shared_model::interface::Transaction> tx =
+      clone(TestTransactionBuilder().createdTime(iroha::time::now()).build());
+
+  auto wrapper = make_test_subscriber<CallExact>(tp->transactionNotifier(), 1);
+  wrapper.subscribe([](auto response) {
+    ASSERT_NO_THROW(
+        boost::apply_visitor(framework::SpecifiedVisitor<
+                                 shared_model::interface::OverloadedTxResponse>(),
+                             response->get()));
+  });
+  tp->transactionHandle(tx);
+  rejected_notifier.get_subscriber().on_next(tx->hash());
+
+  ASSERT_TRUE(wrapper.validate());
+}
@@ -66,6 +66,14 @@ class CustomPeerCommunicationServiceMock : public PeerCommunicationService {
     return commit_notifier_.get_observable();
   }
 
+  rxcpp::observable<shared_model::interface::types::HashType>
+  on_rejected_transaction() const override {
+    return rejected_notifier_.get_observable();
+  }
+
+  rxcpp::subjects::subject<shared_model::interface::types::HashType>
+      rejected_notifier_;
+
  private:
   rxcpp::subjects::subject<std::shared_ptr<shared_model::interface::Proposal>>
       prop_notifier_;
@@ -4,13 +4,25 @@
  */
 
 #include <gtest/gtest.h>
+#include "builders/protobuf/common_objects/proto_account_builder.hpp"
 #include "builders/protobuf/common_objects/proto_signature_builder.hpp"
+#include "common/cloneable.hpp"
 #include "cryptography/crypto_provider/crypto_defaults.hpp"
+#include "datetime/time.hpp"
+#include "module/irohad/ametsuchi/ametsuchi_mocks.hpp"
+#include "module/shared_model/builders/protobuf/test_proposal_builder.hpp"
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+#include "validation/impl/stateful_validator_impl.hpp"
 #include "validation/utils.hpp"
 
 using namespace iroha::validation;
 using namespace shared_model::crypto;
 
+using ::testing::_;
+using ::testing::Invoke;
+using ::testing::Return;
+using ::testing::UnorderedElementsAre;
+
 class SignaturesSubset : public testing::Test {
  public:
   auto makeSignature(PublicKey key, std::string sign) {
@@ -78,3 +90,220 @@ TEST_F(SignaturesSubset, PublickeyUniqueness) {
   signatures.push_back(makeSignature(PublicKey("c"), ""));
   ASSERT_FALSE(signaturesSubset(signatures, keys));
 }
+
+/**
+ * @given set of two keys and signatures with keys from the set and outside
+ * of it
+ * @when signaturesSubset is executed for the set
+ * @then returned true only for signatures with keys from the set
+ */
+TEST_F(SignaturesSubset, KeySet) {
+  PublicKeySet keys{PublicKey("a").hex(), PublicKey("b").hex()};
+  std::vector<shared_model::proto::Signature> signatures;
+  signatures.push_back(makeSignature(PublicKey("b"), ""));
+  ASSERT_TRUE(signaturesSubset(signatures, keys));
+  signatures.push_back(makeSignature(PublicKey("c"), ""));
+  ASSERT_FALSE(signaturesSubset(signatures, keys));
+}
+
+class StatefulValidatorTest : public testing::Test {
+ public:
+  /**
+   * @return stateless valid transaction of creator which transfers asset to
+   * given account
+   */
+  auto makeTransfer(const std::string &creator, const std::string &dest) {
+    return TestTransactionBuilder()
+        .createdTime(iroha::time::now())
+        .creatorAccountId(creator)
+        .quorum(1)
+        .transferAsset(creator, dest, "coin#test", "", "1.0")
+        .build();
+  }
+
+  /**
+   * @return transaction with added signature of given key
+   */
+  auto sign(shared_model::proto::Transaction tx, const std::string &key) {
+    tx.addSignature(Signed("signature"), PublicKey(key));
+    return tx;
+  }
+
+  /**
+   * @return account of given id with quorum 1
+   */
+  std::shared_ptr<shared_model::interface::Account> makeAccount(
+      const std::string &account_id) {
+    return clone(shared_model::proto::AccountBuilder()
+                     .accountId(account_id)
+                     .domainId("test")
+                     .quorum(1)
+                     .jsonData("{}")
+                     .build());
+  }
+
+  /**
+   * Make temporary wsv pass given queries to the validator
+   */
+  void applyWithQueries(iroha::ametsuchi::WsvQuery &queries) {
+    EXPECT_CALL(wsv, apply(_, _))
+        .WillRepeatedly(Invoke([&queries](const auto &tx, auto function) {
+          return function(tx, queries);
+        }));
+  }
+
+  auto makeProposal(
+      const std::vector<shared_model::proto::Transaction> &transactions) {
+    return TestProposalBuilder()
+        .height(2)
+        .createdTime(iroha::time::now())
+        .transactions(transactions)
+        .build();
+  }
+
+  /**
+   * @return creator accounts of transactions of the proposal
+   */
+  std::vector<std::string> creators(
+      const shared_model::interface::Proposal &proposal) {
+    std::vector<std::string> result;
+    for (const auto &tx : proposal.transactions()) {
+      result.push_back(tx.creatorAccountId());
+    }
+    return result;
+  }
+
+  iroha::ametsuchi::MockTemporaryWsv wsv;
+};
+
+/**
+ * @given validator with two workers and proposal with two independent
+ * transactions
+ * @when proposal is validated
+ * @then the second transaction is validated on a fork of temporary wsv
+ * AND only transactions valid on their wsv are in the verified proposal
+ */
+TEST_F(StatefulValidatorTest, IndependentTransactionsAreValidatedOnFork) {
+  auto proposal = makeProposal(
+      {makeTransfer("a@test", "x@test"), makeTransfer("b@test", "y@test")});
+  EXPECT_CALL(wsv, apply(_, _)).WillOnce(Return(true));
+  EXPECT_CALL(wsv, fork()).WillOnce(Invoke([] {
+    auto fork = std::make_unique<iroha::ametsuchi::MockTemporaryWsv>();
+    EXPECT_CALL(*fork, apply(_, _)).WillOnce(Return(false));
+    return iroha::expected::makeValue<
+        std::unique_ptr<iroha::ametsuchi::TemporaryWsv>>(std::move(fork));
+  }));
+
+  auto verified = StatefulValidatorImpl(2).validate(proposal, wsv);
+
+  ASSERT_EQ(std::vector<std::string>{"a@test"}, creators(*verified));
+}
+
+/**
+ * @given validator with two workers and proposal with two transactions
+ * which transfer to the same account
+ * @when proposal is validated
+ * @then temporary wsv is not forked
+ * AND both transactions are validated in original order
+ */
+TEST_F(StatefulValidatorTest, ConflictingTransactionsAreValidatedSerially) {
+  auto proposal = makeProposal(
+      {makeTransfer("a@test", "x@test"), makeTransfer("b@test", "x@test")});
+  EXPECT_CALL(wsv, fork()).Times(0);
+  EXPECT_CALL(wsv, apply(_, _)).Times(2).WillRepeatedly(Return(true));
+
+  auto verified = StatefulValidatorImpl(2).validate(proposal, wsv);
+
+  ASSERT_EQ((std::vector<std::string>{"a@test", "b@test"}),
+            creators(*verified));
+}
+
+/**
+ * @given validator with two workers and proposal with two independent
+ * transactions
+ * @when proposal is validated AND temporary wsv cannot be forked
+ * @then all transactions are validated serially
+ */
+TEST_F(StatefulValidatorTest, ForkFailureFallsBackToSerialValidation) {
+  auto proposal = makeProposal(
+      {makeTransfer("a@test", "x@test"), makeTransfer("b@test", "y@test")});
+  EXPECT_CALL(wsv, fork()).WillOnce(Invoke([] {
+    return iroha::expected::makeError<std::string>("no connection");
+  }));
+  EXPECT_CALL(wsv, apply(_, _)).Times(2).WillRepeatedly(Return(true));
+
+  auto verified = StatefulValidatorImpl(2).validate(proposal, wsv);
+
+  ASSERT_EQ((std::vector<std::string>{"a@test", "b@test"}),
+            creators(*verified));
+}
+
+/**
+ * @given proposal with transactions of two creators, one of transactions is
+ * signed by a key which is not a signatory of its creator
+ * @when proposal is validated
+ * @then accounts and signatories of both creators are loaded with a single
+ * query each
+ * AND the transaction with wrong signature is rejected
+ */
+TEST_F(StatefulValidatorTest, CreatorsAreLoadedOnce) {
+  auto proposal =
+      makeProposal({sign(makeTransfer("a@test", "x@test"), "a"),
+                    sign(makeTransfer("b@test", "y@test"), "b"),
+                    sign(makeTransfer("a@test", "z@test"), "b")});
+  iroha::ametsuchi::MockWsvQuery queries;
+  applyWithQueries(queries);
+  EXPECT_CALL(queries,
+              getAccounts(UnorderedElementsAre("a@test", "b@test")))
+      .WillOnce(Return(std::vector<
+                       std::shared_ptr<shared_model::interface::Account>>{
+          makeAccount("a@test"), makeAccount("b@test")}));
+  EXPECT_CALL(queries,
+              getAccountsSignatories(UnorderedElementsAre("a@test", "b@test")))
+      .WillOnce(Return(iroha::ametsuchi::MockWsvQuery::AccountsSignatories{
+          {"a@test", PublicKey("a")}, {"b@test", PublicKey("b")}}));
+  EXPECT_CALL(queries, getAccount(_)).Times(0);
+  EXPECT_CALL(queries, getSignatories(_)).Times(0);
+
+  auto verified = StatefulValidatorImpl().validate(proposal, wsv);
+
+  ASSERT_EQ((std::vector<std::string>{"a@test", "b@test"}),
+            creators(*verified));
+}
+
+/**
+ * @given proposal where the first transaction adds a signatory to its
+ * creator
+ * @when proposal is validated
+ * @then account and signatories of that creator are queried for every its
+ * transaction, and only the other creator is loaded in advance
+ */
+TEST_F(StatefulValidatorTest, ChangedCreatorIsQueried) {
+  auto proposal = makeProposal(
+      {sign(TestTransactionBuilder()
+                .createdTime(iroha::time::now())
+                .creatorAccountId("a@test")
+                .quorum(1)
+                .addSignatory("a@test", PublicKey(std::string(32, 'k')))
+                .build(),
+            "a"),
+       sign(makeTransfer("b@test", "y@test"), "b")});
+  iroha::ametsuchi::MockWsvQuery queries;
+  applyWithQueries(queries);
+  EXPECT_CALL(queries, getAccounts(UnorderedElementsAre("b@test")))
+      .WillOnce(Return(std::vector<
+                       std::shared_ptr<shared_model::interface::Account>>{
+          makeAccount("b@test")}));
+  EXPECT_CALL(queries, getAccountsSignatories(UnorderedElementsAre("b@test")))
+      .WillOnce(Return(iroha::ametsuchi::MockWsvQuery::AccountsSignatories{
+          {"b@test", PublicKey("b")}}));
+  EXPECT_CALL(queries, getAccount("a@test"))
+      .WillOnce(Return(makeAccount("a@test")));
+  EXPECT_CALL(queries, getSignatories("a@test"))
+      .WillOnce(Return(std::vector<PublicKey>{PublicKey("a")}));
+
+  auto verified = StatefulValidatorImpl().validate(proposal, wsv);
+
+  ASSERT_EQ((std::vector<std::string>{"a@test", "b@test"}),
+            creators(*verified));
+}
@@ -0,0 +1,79 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <gtest/gtest.h>
+
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+#include "validation/transaction_conflicts.hpp"
+
+using namespace iroha::validation;
+
+using Groups = std::vector<std::vector<size_t>>;
+
+/**
+ * @given transaction with transfer of asset
+ * @when accessed keys are derived
+ * @then creator and both accounts of transfer and the asset are read
+ * AND balances of both accounts are written
+ */
+TEST(TransactionConflictsTest, TransferKeys) {
+  auto tx = TestTransactionBuilder()
+                .creatorAccountId("admin@test")
+                .transferAsset("a@test", "b@test", "coin#test", "", "1.0")
+                .build();
+
+  auto keys = accessedKeys(tx);
+
+  EXPECT_FALSE(keys.global);
+  EXPECT_EQ((std::vector<std::string>{"account:admin@test",
+                                      "asset:coin#test",
+                                      "account:a@test",
+                                      "account:b@test"}),
+            keys.reads);
+  EXPECT_EQ((std::vector<std::string>{"account_asset:a@test/coin#test",
+                                      "account_asset:b@test/coin#test"}),
+            keys.writes);
+}
+
+/**
+ * @given transactions which write different keys and read the same one
+ * @when they are split into groups
+ * @then every transaction is in its own group
+ */
+TEST(TransactionConflictsTest, SharedReadsDoNotConflict) {
+  std::vector<AccessedKeys> keys{{{"asset"}, {"a"}, false},
+                                 {{"asset"}, {"b"}, false},
+                                 {{"asset"}, {"c"}, false}};
+
+  EXPECT_EQ((Groups{{0}, {1}, {2}}), independentGroups(keys));
+}
+
+/**
+ * @given transactions where the first and the last write the same key, and
+ * the second one reads a key written by the third one
+ * @when they are split into groups
+ * @then conflicting transactions are in the same group in original order
+ */
+TEST(TransactionConflictsTest, ConflictingTransactionsAreGrouped) {
+  std::vector<AccessedKeys> keys{{{}, {"a"}, false},
+                                 {{"c"}, {"b"}, false},
+                                 {{}, {"c"}, false},
+                                 {{}, {"a"}, false}};
+
+  EXPECT_EQ((Groups{{0, 3}, {1, 2}}), independentGroups(keys));
+}
+
+/**
+ * @given independent transactions and a transaction which changes
+ * permissions
+ * @when they are split into groups
+ * @then all transactions are in a single group
+ */
+TEST(TransactionConflictsTest, GlobalTransactionConflictsWithAll) {
+  std::vector<AccessedKeys> keys{
+      {{}, {"a"}, false}, {{}, {}, true}, {{}, {"b"}, false}};
+
+  EXPECT_EQ((Groups{{0, 1, 2}}), independentGroups(keys));
+}
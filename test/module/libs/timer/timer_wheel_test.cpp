@@ -0,0 +1,141 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "timer/timer_wheel.hpp"
+
+#include <gtest/gtest.h>
+#include <future>
+
+using namespace iroha::timer;
+using namespace std::chrono_literals;
+
+class TimerWheelTest : public ::testing::Test {
+ public:
+  /**
+   * Advance the wheel by given number of ticks
+   */
+  void tick(size_t ticks) {
+    for (size_t i = 0; i < ticks; ++i) {
+      wheel.tick();
+    }
+  }
+
+  /// 10 ms resolution, 8 slots
+  TimerWheel wheel{10ms, 8};
+  size_t invoked = 0;
+};
+
+/**
+ * @given task scheduled after 25 ms
+ * @when wheel is advanced
+ * @then task is invoked exactly once on the third tick
+ */
+TEST_F(TimerWheelTest, OneShotIsInvokedOnce) {
+  auto handle = wheel.schedule(25ms, [this] { ++invoked; });
+
+  tick(2);
+  ASSERT_EQ(0, invoked);
+  tick(1);
+  ASSERT_EQ(1, invoked);
+  ASSERT_TRUE(handle.done());
+  tick(20);
+  ASSERT_EQ(1, invoked);
+}
+
+/**
+ * @given task with delay longer than a revolution of the wheel
+ * @when wheel is advanced
+ * @then task is invoked after the whole delay
+ */
+TEST_F(TimerWheelTest, LongDelayTakesSeveralRevolutions) {
+  wheel.schedule(200ms, [this] { ++invoked; });
+
+  tick(19);
+  ASSERT_EQ(0, invoked);
+  tick(1);
+  ASSERT_EQ(1, invoked);
+}
+
+/**
+ * @given scheduled task
+ * @when it is cancelled before expiration
+ * @then it is not invoked
+ */
+TEST_F(TimerWheelTest, CancelledIsNotInvoked) {
+  auto handle = wheel.schedule(10ms, [this] { ++invoked; });
+  handle.cancel();
+
+  tick(10);
+  ASSERT_EQ(0, invoked);
+  ASSERT_TRUE(handle.done());
+}
+
+/**
+ * @given periodic task
+ * @when wheel is advanced and then the task is cancelled
+ * @then task is invoked every period until cancellation
+ */
+TEST_F(TimerWheelTest, PeriodicUntilCancelled) {
+  auto handle = wheel.schedulePeriodic(30ms, [this] { ++invoked; });
+
+  tick(30);
+  ASSERT_EQ(10, invoked);
+  handle.cancel();
+  tick(30);
+  ASSERT_EQ(10, invoked);
+}
+
+/**
+ * @given periodic task which cancels itself on the second invocation
+ * @when wheel is advanced
+ * @then task is invoked twice
+ */
+TEST_F(TimerWheelTest, TaskCancelsItself) {
+  TimerHandle handle;
+  handle = wheel.schedulePeriodic(10ms, [this, &handle] {
+    if (++invoked == 2) {
+      handle.cancel();
+    }
+  });
+
+  tick(10);
+  ASSERT_EQ(2, invoked);
+}
+
+/**
+ * @given task which schedules another one
+ * @when wheel is advanced
+ * @then both tasks are invoked
+ */
+TEST_F(TimerWheelTest, TaskSchedulesTask) {
+  wheel.schedule(10ms, [this] {
+    ++invoked;
+    wheel.schedule(10ms, [this] { ++invoked; });
+  });
+
+  tick(1);
+  ASSERT_EQ(1, invoked);
+  tick(1);
+  ASSERT_EQ(2, invoked);
+}
+
+/**
+ * @given started wheel
+ * @when task is scheduled
+ * @then it is invoked on the thread of the wheel not earlier than delay
+ */
+TEST_F(TimerWheelTest, StartedWheelInvokesTask) {
+  std::promise<std::thread::id> promise;
+  auto start = TimerWheel::Clock::now();
+  wheel.start();
+  wheel.schedule(
+      30ms, [&promise] { promise.set_value(std::this_thread::get_id()); });
+
+  auto future = promise.get_future();
+  ASSERT_EQ(std::future_status::ready, future.wait_for(1s));
+  EXPECT_NE(std::this_thread::get_id(), future.get());
+  EXPECT_GE(TimerWheel::Clock::now() - start, 30ms);
+  wheel.stop();
+}
@@ -53,3 +53,37 @@ TEST(BlockBuilderTest, DISABLED_BlockWithNoTransactions) {
           .transactions(std::vector<shared_model::proto::Transaction>())
           .build());
 }
+
+/**
+ * @given UnsignedBlockBuilder stored in a variable with transactions set
+ * @when block is built from it twice and its copy gets another transaction
+ * @then both blocks contain the transaction
+ * AND the stored builder is not changed by the copy
+ */
+TEST(BlockBuilderTest, LvalueBuilderIsNotMovedFrom) {
+  std::vector<shared_model::proto::Transaction> txs{
+      TestTransactionBuilder()
+          .createdTime(iroha::time::now())
+          .creatorAccountId("admin@test")
+          .quorum(1)
+          .addAssetQuantity("admin@test", "coin#test", "1.0")
+          .build()};
+  auto builder =
+      UnsignedBlockBuilder()
+          .createdTime(iroha::time::now())
+          .prevHash(shared_model::crypto::Hash(std::string(
+              shared_model::crypto::DefaultCryptoAlgorithmType::kHashLength,
+              '0')))
+          .height(1)
+          .transactions(txs);
+
+  auto first = builder.build();
+  auto second = builder.build();
+  auto third = builder.transactions(txs).build();
+  auto fourth = builder.build();
+
+  EXPECT_EQ(1, first.transactions().size());
+  EXPECT_EQ(1, second.transactions().size());
+  EXPECT_EQ(2, third.transactions().size());
+  EXPECT_EQ(1, fourth.transactions().size());
+}
@@ -57,7 +57,11 @@ using TransactionResponsTypes =
                      TransactionResponseBuilderTestCase<
                          shared_model::interface::NotReceivedTxResponse,
                          &TransactionStatusBuilder::notReceived,
-                         iroha::protocol::NOT_RECEIVED> >;
+                         iroha::protocol::NOT_RECEIVED>,
+                     TransactionResponseBuilderTestCase<
+                         shared_model::interface::OverloadedTxResponse,
+                         &TransactionStatusBuilder::overloaded,
+                         iroha::protocol::OVERLOADED> >;
 TYPED_TEST_CASE(ProtoTransactionStatusBuilderTest, TransactionResponsTypes);
 
 /**
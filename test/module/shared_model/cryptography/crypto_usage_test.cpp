@@ -101,6 +101,30 @@ TEST_F(CryptoUsageTest, RawSignAndVerifyTest) {
   ASSERT_TRUE(verified);
 }
 
+/**
+ * @given signatures of the same and different data by several keypairs
+ * @when signatures are verified in a batch
+ * @then indices of incorrect signatures are returned
+ */
+TEST_F(CryptoUsageTest, BatchVerify) {
+  auto other_data = Blob("other data");
+  auto other_keypair = DefaultCryptoAlgorithmType::generateKeypair();
+  auto first = DefaultCryptoAlgorithmType::sign(data, keypair);
+  auto second = DefaultCryptoAlgorithmType::sign(data, other_keypair);
+  auto third = DefaultCryptoAlgorithmType::sign(other_data, keypair);
+
+  ASSERT_TRUE(CryptoVerifier<>::verifyBatch(
+                  {{first, data, keypair.publicKey()},
+                   {second, data, other_keypair.publicKey()},
+                   {third, other_data, keypair.publicKey()}})
+                  .empty());
+  ASSERT_EQ(CryptoVerifier<>::verifyBatch(
+                {{first, data, keypair.publicKey()},
+                 {second, data, keypair.publicKey()},
+                 {third, data, keypair.publicKey()}}),
+            std::vector<size_t>({1, 2}));
+}
+
 /**
  * @given unsigned block
  * @when verify block
@@ -0,0 +1,62 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "utils/thread_pool.hpp"
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+using shared_model::detail::ThreadPool;
+
+/**
+ * @given thread pool
+ * @when parallelFor is executed for range of indices
+ * @then function is called exactly once for every index
+ */
+TEST(ThreadPoolTest, EveryIndexIsProcessedOnce) {
+  ThreadPool pool(3);
+  std::vector<std::atomic<int>> calls(1000);
+
+  pool.parallelFor(calls.size(), [&calls](size_t i) { ++calls[i]; });
+
+  for (const auto &count : calls) {
+    ASSERT_EQ(1, count);
+  }
+}
+
+/**
+ * @given thread pool
+ * @when parallelFor is executed from a function called by parallelFor
+ * @then all indices of both calls are processed
+ */
+TEST(ThreadPoolTest, NestedCallsAreProcessed) {
+  ThreadPool pool(2);
+  std::atomic<size_t> calls{0};
+
+  pool.parallelFor(10, [&pool, &calls](size_t) {
+    pool.parallelFor(10, [&calls](size_t) { ++calls; });
+  });
+
+  ASSERT_EQ(100, calls);
+}
+
+/**
+ * @given thread pool
+ * @when function called by parallelFor throws
+ * @then the exception is rethrown to the caller of parallelFor
+ */
+TEST(ThreadPoolTest, ExceptionIsRethrown) {
+  ThreadPool pool(2);
+
+  ASSERT_THROW(pool.parallelFor(100,
+                                [](size_t i) {
+                                  if (i == 50) {
+                                    throw std::runtime_error("error");
+                                  }
+                                }),
+               std::runtime_error);
+}
@@ -0,0 +1,72 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <gtest/gtest.h>
+
+#include "datetime/time.hpp"
+#include "module/shared_model/builders/protobuf/test_proposal_builder.hpp"
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+#include "validators/default_validator.hpp"
+
+using namespace shared_model::validation;
+
+class ContainerValidatorTest : public ::testing::Test {
+ public:
+  /**
+   * @return proposal with given number of transactions, where every
+   * seventh one has invalid creator
+   */
+  auto makeProposal(size_t size) {
+    std::vector<shared_model::proto::Transaction> transactions;
+    for (size_t i = 0; i < size; ++i) {
+      auto creator = i % 7 == 0 ? "invalid" + std::to_string(i) : "a@test";
+      transactions.push_back(TestTransactionBuilder()
+                                 .createdTime(iroha::time::now())
+                                 .creatorAccountId(creator)
+                                 .quorum(1)
+                                 .setAccountQuorum("a@test", 1)
+                                 .build());
+    }
+    return TestProposalBuilder()
+        .height(2)
+        .createdTime(iroha::time::now())
+        .transactions(transactions)
+        .build();
+  }
+
+  /**
+   * @return reasons of transactions of the proposal in their order
+   */
+  GroupedReasons transactionReasons(
+      const shared_model::interface::Proposal &proposal) {
+    GroupedReasons reasons;
+    for (const auto &tx : proposal.transactions()) {
+      auto answer = DefaultTransactionValidator().validate(tx);
+      if (answer.hasErrors()) {
+        reasons.push_back("Tx: " + answer.reason());
+      }
+    }
+    return reasons;
+  }
+};
+
+/**
+ * @given proposals with number of transactions below and above the
+ * threshold of parallel validation, where some transactions are invalid
+ * @when proposals are validated
+ * @then reasons of invalid transactions are reported in order of
+ * transactions
+ */
+TEST_F(ContainerValidatorTest, ReasonsAreInOrderOfTransactions) {
+  const auto threshold = DefaultProposalValidator::kParallelValidationThreshold;
+  for (auto size : {threshold / 2, threshold * 8}) {
+    auto proposal = makeProposal(size);
+
+    auto answer = DefaultProposalValidator().validate(proposal);
+
+    ASSERT_EQ(transactionReasons(proposal),
+              answer.getReasonsMap().at("Proposal"));
+  }
+}
@@ -0,0 +1,160 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <functional>
+#include <random>
+#include <regex>
+
+#include <gtest/gtest.h>
+
+#include "validators/field_scanners.hpp"
+
+using namespace shared_model::validation;
+
+/// number of random strings checked for every format
+static const size_t kIterations = 20000;
+
+/**
+ * Differential tests of scanners against regular expressions, which were
+ * used by field validator before
+ */
+class FieldScannersTest : public ::testing::Test {
+ public:
+  static const std::string kName;
+  static const std::string kDomain;
+  static const std::string kIpV4;
+
+  /**
+   * @return string of random tokens, which are either characters met in
+   * fields or pieces near the boundaries of formats
+   */
+  std::string randomString() {
+    static const std::string kAlphabet = "azAZ09_-.@#:";
+    static const std::vector<std::string> kPieces{
+        "0", "00", "1", "255", "256", "65535", "65536", "99999", "1.2.3.4"};
+    std::string result;
+    auto tokens = std::uniform_int_distribution<size_t>(0, 8)(generator_);
+    for (size_t i = 0; i < tokens; ++i) {
+      switch (std::uniform_int_distribution<int>(0, 3)(generator_)) {
+        case 0:
+          result += kPieces[pick(kPieces.size())];
+          break;
+        case 1:
+          // long runs reach length limits of names and domain labels
+          result += std::string(pick(66) + 1, kAlphabet[pick(4)]);
+          break;
+        default:
+          result += kAlphabet[pick(kAlphabet.size())];
+      }
+    }
+    return result;
+  }
+
+  /**
+   * Check that scanner and regex agree on many random strings
+   * @param pattern - regular expression of the format
+   * @param scanner - recognizer of the same format
+   */
+  void compare(const std::string &pattern,
+               std::function<bool(const std::string &)> scanner) {
+    std::regex regex(pattern);
+    size_t accepted = 0;
+    for (size_t i = 0; i < kIterations; ++i) {
+      auto value = randomString();
+      auto expected = std::regex_match(value, regex);
+      ASSERT_EQ(expected, scanner(value)) << "value: '" << value << "'";
+      accepted += expected;
+    }
+    // random strings should exercise both outcomes
+    EXPECT_GT(accepted, 0);
+    EXPECT_LT(accepted, kIterations);
+  }
+
+ private:
+  size_t pick(size_t size) {
+    return std::uniform_int_distribution<size_t>(0, size - 1)(generator_);
+  }
+
+  std::mt19937 generator_{42};
+};
+
+const std::string FieldScannersTest::kName = R"#([a-z_0-9]{1,32})#";
+const std::string FieldScannersTest::kDomain =
+    R"#(([a-zA-Z]([a-zA-Z0-9\-]{0,61}[a-zA-Z0-9])?\.)*)#"
+    R"#([a-zA-Z]([a-zA-Z0-9\-]{0,61}[a-zA-Z0-9])?)#";
+const std::string FieldScannersTest::kIpV4 =
+    R"#(^((([0-9]|[1-9][0-9]|1[0-9]{2}|2[0-4][0-9]|25[0-5])\.){3})#"
+    R"#(([0-9]|[1-9][0-9]|1[0-9]{2}|2[0-4][0-9]|25[0-5])))#";
+
+/**
+ * @given random strings
+ * @when they are checked as names of accounts, assets and roles
+ * @then scanner agrees with the regex
+ */
+TEST_F(FieldScannersTest, Name) {
+  compare(kName, [](const auto &value) { return scanners::isName(value); });
+}
+
+/**
+ * @given random strings
+ * @when they are checked as keys of account details
+ * @then scanner agrees with the regex
+ */
+TEST_F(FieldScannersTest, DetailKey) {
+  compare(R"([A-Za-z0-9_]{1,64})",
+          [](const auto &value) { return scanners::isDetailKey(value); });
+}
+
+/**
+ * @given random strings
+ * @when they are checked as domain ids
+ * @then scanner agrees with the regex
+ */
+TEST_F(FieldScannersTest, Domain) {
+  compare(kDomain,
+          [](const auto &value) { return scanners::isDomain(value); });
+}
+
+/**
+ * @given random strings
+ * @when they are checked as account ids
+ * @then scanner agrees with the regex
+ */
+TEST_F(FieldScannersTest, AccountId) {
+  compare(kName + R"#(\@)#" + kDomain,
+          [](const auto &value) { return scanners::isAccountId(value); });
+}
+
+/**
+ * @given random strings
+ * @when they are checked as asset ids
+ * @then scanner agrees with the regex
+ */
+TEST_F(FieldScannersTest, AssetId) {
+  compare(kName + R"#(\#)#" + kDomain,
+          [](const auto &value) { return scanners::isAssetId(value); });
+}
+
+/**
+ * @given random strings
+ * @when they are checked as peer addresses
+ * @then scanner agrees with the regex
+ */
+TEST_F(FieldScannersTest, PeerAddress) {
+  compare("((" + kIpV4 + ")|(" + kDomain + ")):"
+              + R"#((6553[0-5]|655[0-2]\d|65[0-4]\d\d|6[0-4]\d{3})#"
+              + R"#(|[1-5]\d{4}|[1-9]\d{0,3}|0)$)#",
+          [](const auto &value) { return scanners::isPeerAddress(value); });
+}
+
+/**
+ * @given random strings
+ * @when they are checked as amounts
+ * @then scanner agrees with the regex
+ */
+TEST_F(FieldScannersTest, Amount) {
+  compare(R"(([0-9]*\.[0-9]+|[0-9]+))",
+          [](const auto &value) { return scanners::isAmount(value); });
+}
@@ -0,0 +1,102 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "validators/signature_cache.hpp"
+
+#include <gtest/gtest.h>
+
+#include "builders/protobuf/common_objects/proto_signature_builder.hpp"
+#include "cryptography/crypto_provider/crypto_defaults.hpp"
+#include "validators/field_validator.hpp"
+
+using namespace shared_model::crypto;
+using shared_model::validation::SignatureCache;
+
+class SignatureCacheTest : public ::testing::Test {
+ public:
+  Hash hash{std::string(32, 'h')};
+  PublicKey public_key{std::string(32, 'p')};
+  Signed signed_data{std::string(64, 's')};
+};
+
+/**
+ * @given empty cache
+ * @when signature is looked up before and after insertion
+ * @then it is found only after insertion
+ * AND lookups are counted as a miss and a hit
+ */
+TEST_F(SignatureCacheTest, InsertedSignatureIsFound) {
+  SignatureCache cache;
+
+  ASSERT_FALSE(cache.contains(hash, public_key, signed_data));
+  cache.insert(hash, public_key, signed_data);
+  ASSERT_TRUE(cache.contains(hash, public_key, signed_data));
+
+  ASSERT_EQ(1, cache.hits());
+  ASSERT_EQ(1, cache.misses());
+  ASSERT_DOUBLE_EQ(0.5, cache.hitRate());
+}
+
+/**
+ * @given cache with a signature
+ * @when the same signature is looked up for another payload or public key
+ * @then it is not found
+ */
+TEST_F(SignatureCacheTest, SignatureOfOtherPayloadIsNotFound) {
+  SignatureCache cache;
+  cache.insert(hash, public_key, signed_data);
+
+  ASSERT_FALSE(
+      cache.contains(Hash(std::string(32, 'x')), public_key, signed_data));
+  ASSERT_FALSE(
+      cache.contains(hash, PublicKey(std::string(32, 'x')), signed_data));
+}
+
+/**
+ * @given cache of small capacity
+ * @when more signatures than the capacity are inserted
+ * @then the cache keeps at most capacity signatures
+ * AND the last inserted signature is remembered
+ */
+TEST_F(SignatureCacheTest, SizeIsBounded) {
+  const size_t capacity = 32;
+  SignatureCache cache(capacity);
+
+  for (size_t i = 0; i < capacity * 10; ++i) {
+    auto id = std::to_string(i);
+    cache.insert(Hash(id), public_key, signed_data);
+  }
+
+  ASSERT_LE(cache.size(), capacity);
+  ASSERT_TRUE(cache.contains(
+      Hash(std::to_string(capacity * 10 - 1)), public_key, signed_data));
+}
+
+/**
+ * @given valid signature of a payload
+ * @when signatures are validated twice
+ * @then both validations succeed
+ * AND the second one finds the signature in the shared cache
+ */
+TEST_F(SignatureCacheTest, FieldValidatorUsesCache) {
+  Blob payload(std::string("payload"));
+  auto keypair = DefaultCryptoAlgorithmType::generateKeypair();
+  std::vector<shared_model::proto::Signature> signatures{
+      shared_model::proto::SignatureBuilder()
+          .publicKey(keypair.publicKey())
+          .signedData(DefaultCryptoAlgorithmType::sign(payload, keypair))
+          .build()};
+  auto &cache = SignatureCache::instance();
+  shared_model::validation::FieldValidator validator;
+
+  shared_model::validation::ReasonsGroupType reason;
+  validator.validateSignatures(reason, signatures, payload);
+  ASSERT_TRUE(reason.second.empty());
+  auto hits = cache.hits();
+  validator.validateSignatures(reason, signatures, payload);
+
+  ASSERT_TRUE(reason.second.empty());
+  ASSERT_EQ(hits + 1, cache.hits());
+}
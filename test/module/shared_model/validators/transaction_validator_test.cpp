@@ -129,3 +129,26 @@ TEST_F(TransactionValidatorTest, StatelessInvalidTest) {
   ASSERT_EQ(answer.getReasonsMap().size(),
             iroha::protocol::Command::descriptor()->field_count() + 1);
 }
+
+/**
+ * @given transaction with two invalid commands of the same type
+ * @when commands validation is invoked
+ * @then answer has a reason for each of commands, named after command index
+ */
+TEST_F(TransactionValidatorTest, SameInvalidCommandsAreReportedSeparately) {
+  auto tx = TestTransactionBuilder()
+                .creatorAccountId(account_id)
+                .createdTime(created_time)
+                .quorum(1)
+                .setAccountQuorum("invalid", 1)
+                .setAccountQuorum("invalid", 1)
+                .build();
+
+  auto answer =
+      shared_model::validation::DefaultTransactionValidator().validate(tx);
+
+  auto reasons = answer.getReasonsMap();
+  ASSERT_EQ(2, reasons.size());
+  ASSERT_EQ(1, reasons.count("0 SetQuorum"));
+  ASSERT_EQ(1, reasons.count("1 SetQuorum"));
+}